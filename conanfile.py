@@ -31,18 +31,42 @@ class ConanProject(ConanFile):
 
     options = { "with_tests": [True, False],
                 "with_docs": [True, False],
-                "with_coverage": [True, False]
+                "with_coverage": [True, False],
+                "with_benchmarks": [True, False],
+                "with_stacktrace": [True, False],
+                "with_error_counters": [True, False],
+                "with_error_observer": [True, False],
+                "with_source_location": [True, False],
+                "with_propagation_sites": [True, False],
+                "propagation_sites": ["ANY"],
+                "with_no_exceptions": [True, False],
+                "with_std_backend": [True, False],
+                "with_compiled": [True, False],
+                "with_modules": [True, False]
     }
 
     default_options = { "with_tests": True,
                         "with_docs": True,
-                        "with_coverage": False }
+                        "with_coverage": False,
+                        "with_benchmarks": False,
+                        "with_stacktrace": False,
+                        "with_error_counters": False,
+                        "with_error_observer": False,
+                        "with_source_location": False,
+                        "with_propagation_sites": False,
+                        "propagation_sites": 8,
+                        "with_no_exceptions": False,
+                        "with_std_backend": False,
+                        "with_compiled": False,
+                        "with_modules": False }
 
     settings = "os", "compiler", "build_type", "arch"
 
     def build_requirements(self):
         self.build_requires("cmake/4.1.2")
         self.test_requires("gtest/1.17.0")
+        if self.options.with_benchmarks:
+            self.test_requires("benchmark/1.9.4")
         self.tool_requires("terminus_cmake/1.0.7")
 
     def requirements(self):
@@ -63,6 +87,17 @@ class ConanProject(ConanFile):
         tc.variables["TERMINUS_OUTCOME_ENABLE_TESTS"]    = self.options.with_tests
         tc.variables["TERMINUS_OUTCOME_ENABLE_DOCS"]     = self.options.with_docs
         tc.variables["TERMINUS_OUTCOME_ENABLE_COVERAGE"] = self.options.with_coverage
+        tc.variables["TERMINUS_OUTCOME_ENABLE_BENCHMARKS"] = self.options.with_benchmarks
+        tc.variables["TERMINUS_OUTCOME_ENABLE_STACKTRACE"] = self.options.with_stacktrace
+        tc.variables["TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS"] = self.options.with_error_counters
+        tc.variables["TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER"] = self.options.with_error_observer
+        tc.variables["TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION"] = self.options.with_source_location
+        tc.variables["TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES"] = self.options.with_propagation_sites
+        tc.variables["TERMINUS_OUTCOME_PROPAGATION_SITES"]      = self.options.propagation_sites
+        tc.variables["TERMINUS_OUTCOME_NO_EXCEPTIONS"]     = self.options.with_no_exceptions
+        tc.variables["TERMINUS_OUTCOME_USE_STD_BACKEND"]   = self.options.with_std_backend
+        tc.variables["TERMINUS_OUTCOME_ENABLE_COMPILED"]   = self.options.with_compiled
+        tc.variables["TERMINUS_OUTCOME_ENABLE_MODULES"]    = self.options.with_modules
 
         tc.generate()
 
@@ -87,6 +122,53 @@ class ConanProject(ConanFile):
          self.cpp_info.bindirs = []
          self.cpp_info.libdirs = []
 
+         if self.options.with_stacktrace:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_ENABLE_STACKTRACE")
+             if self.settings.os in ["Linux", "FreeBSD"]:
+                 self.cpp_info.system_libs.append("dl")
+
+             # libstdc++ keeps std::stacktrace in a separate static library
+             if self.settings.get_safe("compiler") == "gcc":
+                 gcc_major = int(str(self.settings.compiler.version).split(".")[0])
+                 if gcc_major >= 14:
+                     self.cpp_info.system_libs.append("stdc++exp")
+                 elif gcc_major == 13:
+                     self.cpp_info.system_libs.append("stdc++_libbacktrace")
+
+         if self.options.with_error_counters:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS")
+
+         if self.options.with_error_observer:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER")
+
+         # Both change the layout of Error, so every consumer must agree on them
+         if self.options.with_source_location:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION")
+
+         if self.options.with_propagation_sites:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES")
+             self.cpp_info.defines.append(f"TERMINUS_OUTCOME_PROPAGATION_SITES={self.options.propagation_sites}")
+
+         if self.options.with_no_exceptions:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_NO_EXCEPTIONS")
+
+         if self.options.with_std_backend:
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_USE_STD_BACKEND")
+
+         # Thread_Pool starts std::thread workers
+         if self.settings.os in ["Linux", "FreeBSD"]:
+             self.cpp_info.system_libs.append("pthread")
+
+         libs = []
+         if self.options.with_compiled:
+             libs.append(f"{self.name}_instantiations")
+             self.cpp_info.defines.append("TERMINUS_OUTCOME_EXTERN_TEMPLATES")
+         if self.options.with_modules:
+             libs.append(f"{self.name}_module")
+         if libs:
+             self.cpp_info.libdirs = ["lib"]
+             self.cpp_info.libs = libs
+
     def export_sources(self):
 
         for p in [ "CMakeLists.txt", "include/*", "test/*", "README.md" ]:
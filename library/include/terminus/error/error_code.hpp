@@ -15,43 +15,52 @@
 #pragma once
 
 // Terminus Libraries
-#include <terminus/outcome/macros.hpp>
+#include <terminus/outcome/error_domain.hpp>
+
+/**
+ * Error codes for all WarpCore issues.  The position in this list is the code value, so new codes
+ * must be appended at the end.
+*/
+#define TERMINUS_CORE_ERROR_CODES( X )                                                    \
+    X( SUCCESS,               "SUCCESS" )                                                 \
+    X( UNKNOWN,               "UNKNOWN" )                                                 \
+    X( ABORTED,               "ABORTED" )                                                 \
+    X( CONVERSION_ERROR,      "CONVERSION_ERROR" )                                        \
+    X( DRIVER_NOT_FOUND,      "DRIVER_NOT_FOUND" )                                        \
+    X( DRIVER_FAILURE,        "DRIVER_FAILURE" )        /* Catch-all for general external library issues. */ \
+    X( DUPLICATE_FOUND,       "DUPLICATE_FOUND" )                                         \
+    X( FEATURE_NOT_SUPPORTED, "FEATURE_NOT_SUPPORTED" )                                   \
+    X( FILE_IO_ERROR,         "FILE_IO_ERROR" )                                           \
+    X( FILE_NOT_FOUND,        "FILE_NOT_FOUND" )                                          \
+    X( GDAL_FAILURE,          "GDAL_FAILURE" )                                            \
+    X( INCORRECT_SIZE,        "INCORRECT_SIZE" )                                          \
+    X( INVALID_CHANNEL_TYPE,  "INVALID_CHANNEL_TYPE" )                                    \
+    X( INVALID_CONFIGURATION, "INVALID_CONFIGURATION" )                                   \
+    X( INVALID_INPUT,         "INVALID_INPUT" )                                           \
+    X( INVALID_PIXEL_TYPE,    "INVALID_PIXEL_TYPE" )                                      \
+    X( INVALID_SIZE,          "INVALID_SIZE" )                                            \
+    X( ISIS_ERROR,            "ISIS_ERROR" )                                              \
+    X( NOT_FOUND,             "NOT_FOUND" )                                               \
+    X( NOT_IMPLEMENTED,       "NOT_IMPLEMENTED" )                                         \
+    X( NOT_SUPPORTED,         "NOT_SUPPORTED" )                                           \
+    X( OPENJPEG_FAILURE,      "OPENJPEG_FAILURE" )      /* Catch-all issue for OpenJPEG API. */ \
+    X( OUT_OF_BOUNDS,         "OUT_OF_BOUNDS" )                                           \
+    X( OUT_OF_MEMORY,         "OUT_OF_MEMORY" )                                           \
+    X( PARSING_ERROR,         "PARSING_ERROR" )                                           \
+    X( UNDEFINED,             "UNDEFINED" )                                               \
+    X( UNINITIALIZED,         "UNINITIALIZED" )
+
+// Generate the Error_Code enumeration and its Error_Category in tmns::core::error
+TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN( tmns::core::error, Error_Code, Error_Category, "Error", TERMINUS_CORE_ERROR_CODES );
 
 namespace tmns::core::error {
 
 /**
- * Custom Error_Code enumeration for all WarpCore issues.
-*/
-enum class Error_Code { SUCCESS               =  0,
-                        UNKNOWN               =  1,
-                        ABORTED               =  2,
-                        CONVERSION_ERROR      =  3,
-                        DRIVER_NOT_FOUND      =  4,
-                        DRIVER_FAILURE        =  5 /**< Catch-all for general external library issues. */,
-                        DUPLICATE_FOUND       =  6,
-                        FEATURE_NOT_SUPPORTED =  7,
-                        FILE_IO_ERROR         =  8,
-                        FILE_NOT_FOUND        =  9,
-                        GDAL_FAILURE          = 10,
-                        INCORRECT_SIZE        = 11,
-                        INVALID_CHANNEL_TYPE  = 12,
-                        INVALID_CONFIGURATION = 13,
-                        INVALID_INPUT         = 14,
-                        INVALID_PIXEL_TYPE    = 15,
-                        INVALID_SIZE          = 16,
-                        ISIS_ERROR            = 17,
-                        NOT_FOUND             = 18,
-                        NOT_IMPLEMENTED       = 19,
-                        NOT_SUPPORTED         = 20,
-                        OPENJPEG_FAILURE      = 21 /**< Catch-all issue for OpenJPEG API. */,
-                        OUT_OF_BOUNDS         = 22,
-                        OUT_OF_MEMORY         = 23,
-                        PARSING_ERROR         = 24,
-                        UNDEFINED             = 25,
-                        UNINITIALIZED         = 26,
-};
+ * @brief Code stored by a `Result_Promise` destroyed without a result.
+ */
+inline Error_Code outcome_broken_promise_code( Error_Code )
+{
+    return Error_Code::ABORTED;
+}
 
 } // End of tmns::core::error namespace
-
-// Mark the error code type so that the library knows it is part of the framework
-TERMINUS_OUTCOME_MARK_ENUM( tmns::core::error::Error_Code )
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    extern_templates.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Explicit instantiations of the common `Result` types over `tmns::core::error::Error_Code`.
+ *
+ * Linking the compiled `terminus_outcome_instantiations` library defines
+ * `TERMINUS_OUTCOME_EXTERN_TEMPLATES`, which makes `terminus/error.hpp` include this file.  The
+ * declarations below are then `extern`, so every translation unit reuses the member functions
+ * compiled once in `library/src/instantiations.cpp` instead of instantiating its own copies.
+ * That source file defines `TERMINUS_OUTCOME_INSTANTIATE_TEMPLATES` to turn them into the
+ * definitions.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Terminus Libraries
+#include <terminus/error/error_category.hpp>
+
+#if defined( TERMINUS_OUTCOME_INSTANTIATE_TEMPLATES )
+    #define TERMINUS_OUTCOME_EXTERN_DECL
+#else
+    #define TERMINUS_OUTCOME_EXTERN_DECL extern
+#endif
+
+/**
+ * Declares `Result<VALUE,Error_Code>` together with the backend type it derives from, which holds
+ * most of the member functions: `std::expected` and `impl::Result_Base`, or Boost.Outcome's
+ * `basic_result`.  Instantiating only `Result` would leave those to every translation unit.
+ */
+#define TERMINUS_OUTCOME_EXTERN_CODE  tmns::core::error::Error_Code
+#define TERMINUS_OUTCOME_EXTERN_ERROR tmns::outcome::Error<TERMINUS_OUTCOME_EXTERN_CODE>
+
+#if defined( TERMINUS_OUTCOME_USE_STD_BACKEND )
+    #define TERMINUS_OUTCOME_EXTERN_RESULT( VALUE )                                                                              \
+        TERMINUS_OUTCOME_EXTERN_DECL template class std::expected<VALUE,TERMINUS_OUTCOME_EXTERN_ERROR>;                          \
+        TERMINUS_OUTCOME_EXTERN_DECL template class tmns::outcome::impl::Result_Base<VALUE,TERMINUS_OUTCOME_EXTERN_CODE>;        \
+        TERMINUS_OUTCOME_EXTERN_DECL template tmns::outcome::impl::Result_Base<VALUE,TERMINUS_OUTCOME_EXTERN_CODE>::Result_Base( \
+            tmns::outcome::impl::Failure_Type<TERMINUS_OUTCOME_EXTERN_ERROR>&& );                                                \
+        TERMINUS_OUTCOME_EXTERN_DECL template class tmns::outcome::Result<VALUE,TERMINUS_OUTCOME_EXTERN_CODE>
+#else
+    #define TERMINUS_OUTCOME_EXTERN_RESULT( VALUE )                                                                              \
+        TERMINUS_OUTCOME_EXTERN_DECL template class BOOST_OUTCOME_V2_NAMESPACE::basic_result<                                    \
+            VALUE,                                                                                                               \
+            TERMINUS_OUTCOME_EXTERN_ERROR,                                                                                       \
+            BOOST_OUTCOME_V2_NAMESPACE::policy::default_policy<VALUE,TERMINUS_OUTCOME_EXTERN_ERROR,void>>;                       \
+        TERMINUS_OUTCOME_EXTERN_DECL template class tmns::outcome::Result<VALUE,TERMINUS_OUTCOME_EXTERN_CODE>
+#endif
+
+TERMINUS_OUTCOME_EXTERN_DECL template class TERMINUS_OUTCOME_EXTERN_ERROR;
+
+TERMINUS_OUTCOME_EXTERN_RESULT( void );
+TERMINUS_OUTCOME_EXTERN_RESULT( bool );
+TERMINUS_OUTCOME_EXTERN_RESULT( int );
+TERMINUS_OUTCOME_EXTERN_RESULT( std::int64_t );
+TERMINUS_OUTCOME_EXTERN_RESULT( std::size_t );
+TERMINUS_OUTCOME_EXTERN_RESULT( double );
+TERMINUS_OUTCOME_EXTERN_RESULT( std::string );
+
+#undef TERMINUS_OUTCOME_EXTERN_RESULT
+#undef TERMINUS_OUTCOME_EXTERN_ERROR
+#undef TERMINUS_OUTCOME_EXTERN_CODE
+#undef TERMINUS_OUTCOME_EXTERN_DECL
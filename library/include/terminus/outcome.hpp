@@ -11,12 +11,33 @@
  * @file    Outcome.hpp
  * @author  Marvin Smith
  * @date    7/7/2023
+ *
+ * Core types: `Error`, `Result`, `Optional`, error categories and domains, and the
+ * `TERMINUS_OUTCOME_TRY` macros.  Optional features are not included, so that consumers only
+ * parse what they use.  Include their headers directly:
+ *
+ * - `terminus/outcome/algorithms.hpp`: parallel algorithms over `Result`
+ * - `terminus/outcome/coroutine.hpp`: `Result` coroutines and `Task`
+ * - `terminus/outcome/error_counters.hpp`: `error_counts()` and `write_prometheus()`
+ * - `terminus/outcome/error_observer.hpp`: the `Error_Ring_Buffer` of recent errors
+ * - `terminus/outcome/format.hpp`: `std::formatter` specializations and `fail( cFormat, ... )`
+ * - `terminus/outcome/future_combinators.hpp`: `when_all()` and `when_any()`
+ * - `terminus/outcome/json.hpp`: `write_json()`
+ * - `terminus/outcome/multi_error.hpp`: `Multi_Error` and `Multi_Error_Collector`
+ * - `terminus/outcome/panic.hpp`: `set_panic_handler()` for builds without exceptions
+ * - `terminus/outcome/result_batch.hpp`: `Result_Batch`
+ * - `terminus/outcome/result_future.hpp`: `Result_Promise`, `Result_Future` and continuations
+ * - `terminus/outcome/thread_pool.hpp`: `Thread_Pool`, which needs C++23
+ * - `terminus/outcome/wire.hpp`: the binary wire format, `encode()` and `Wire_Reader`
  */
 #pragma once
 
 #include <terminus/outcome/exports.hpp>
 #include <terminus/outcome/error.hpp>
+#include <terminus/outcome/error_arena.hpp>
 #include <terminus/outcome/error_category.hpp>
+#include <terminus/outcome/error_domain.hpp>
+#include <terminus/outcome/error_stacktrace.hpp>
 #include <terminus/outcome/macros.hpp>
 #include <terminus/outcome/optional.hpp>
 #include <terminus/outcome/result.hpp>
@@ -0,0 +1,511 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    algorithms.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Parallel algorithms over ranges of inputs whose per-element operation returns a `Result`.
+ *
+ * Each algorithm takes either a standard execution policy or a `Result_Executor` such as
+ * `Thread_Pool`.  The range is split into chunks that workers process in index order.  The
+ * algorithms that stop on failure share an `Error_Latch` holding the lowest failing index seen so
+ * far: elements past it are skipped, elements before it still run, so the error returned is
+ * always the one at the lowest index, however the work was scheduled.
+ *
+ * An exception thrown by the element function on an executor is rethrown to the caller once
+ * every chunk has finished or been skipped.  Under an execution policy the standard library
+ * calls `std::terminate()` instead.
+ *
+ * @note Not included by `terminus/outcome.hpp`.  With libstdc++ and the TBB headers installed,
+ *       every translation unit including `<execution>` has to link TBB.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Standard execution policies, such as `std::execution::par`.
+ */
+template <class PolicyT>
+concept Execution_Policy = std::is_execution_policy_v<std::remove_cvref_t<PolicyT>>;
+
+namespace impl {
+
+/**
+ * Result type of calling `FuncT` on an element of `RangeT`.
+ */
+template <class RangeT, class FuncT>
+using Element_Result_T = std::remove_cvref_t<std::invoke_result_t<FuncT&, std::ranges::range_reference_t<RangeT>>>;
+
+/**
+ * Lock-free first-error latch shared by the workers of one algorithm.
+ *
+ * Holds the lowest index that has failed so far.  Workers skip the elements after it, which can
+ * no longer change the outcome.  A chunk stops at its first failure, so each chunk owns one
+ * error slot, written only by a failure that lowered the index.  Nothing blocks, so the element
+ * function may run under `std::execution::par_unseq` or `unseq`.
+ */
+template <class ErrorCodeT>
+class Error_Latch
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param chunks Number of chunks the work is split into.
+         */
+        explicit Error_Latch( std::size_t chunks )
+          : m_failures( chunks )
+        {}
+
+        /**
+         * @brief Check whether element `index` can be skipped.
+         */
+        bool stopped_before( std::size_t index ) const noexcept
+        {
+            return index > m_first.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Record that element `index` of chunk `chunk` failed with `error`.  The error is
+         *        dropped if a lower index has already failed.
+         */
+        void fail( std::size_t chunk, std::size_t index, Error<ErrorCodeT>&& error ) noexcept
+        {
+            auto first = m_first.load( std::memory_order_relaxed );
+            while( index < first )
+            {
+                if( m_first.compare_exchange_weak( first, index, std::memory_order_relaxed ) )
+                {
+                    m_failures[chunk].emplace( index, std::move( error ) );
+                    return;
+                }
+            }
+        }
+
+        /**
+         * @brief Take the error at the lowest failing index, if any.  Call once every worker
+         *        has finished.
+         */
+        std::optional<Error<ErrorCodeT>> take_error() noexcept
+        {
+            std::optional<Failure>* lowest = nullptr;
+            for( auto& failure : m_failures )
+            {
+                if( failure && ( lowest == nullptr || failure->index < ( *lowest )->index ) )
+                {
+                    lowest = &failure;
+                }
+            }
+            if( lowest == nullptr )
+            {
+                return std::nullopt;
+            }
+            return std::move( ( *lowest )->error );
+        }
+
+    private:
+
+        /// Error recorded by a chunk
+        struct Failure
+        {
+            Failure( std::size_t i, Error<ErrorCodeT>&& e ) noexcept
+              : index{ i }, error{ std::move( e ) }
+            {}
+
+            std::size_t       index;
+            Error<ErrorCodeT> error;
+        };
+
+        /// Lowest failing index so far
+        std::atomic<std::size_t> m_first{ std::numeric_limits<std::size_t>::max() };
+
+        /// Failure of each chunk, if it lowered `m_first`
+        std::vector<std::optional<Failure>> m_failures;
+
+}; // End of Error_Latch Class
+
+/**
+ * @brief Number of chunks to split `count` elements into for `workers` workers.  Several chunks
+ *        per worker keep the load balanced when element costs vary.
+ */
+inline std::size_t chunk_count( std::size_t count, std::size_t workers ) noexcept
+{
+    return std::min( count, std::max<std::size_t>( workers, 1 ) * 4 );
+}
+
+/**
+ * @brief Worker count of an executor, if it reports one.
+ */
+template <class ExecutorT>
+std::size_t worker_count( const ExecutorT& executor ) noexcept
+{
+    if constexpr ( requires { { executor.size() } -> std::convertible_to<std::size_t>; } )
+    {
+        return executor.size();
+    }
+    else
+    {
+        return std::max( 1u, std::thread::hardware_concurrency() );
+    }
+}
+
+/**
+ * @brief Run `body( chunk, begin, end )` over `chunks` chunks of `count` elements, under a
+ *        standard execution policy.
+ */
+template <Execution_Policy PolicyT, class BodyT>
+void for_each_chunk( PolicyT&& policy, std::size_t count, std::size_t chunks, BodyT&& body )
+{
+    std::vector<std::size_t> ids( chunks );
+    std::iota( ids.begin(), ids.end(), std::size_t{ 0 } );
+    std::for_each( std::forward<PolicyT>( policy ), ids.begin(), ids.end(), [&]( std::size_t chunk )
+    {
+        body( chunk, chunk * count / chunks, ( chunk + 1 ) * count / chunks );
+    } );
+}
+
+/**
+ * State of a `for_each_chunk()` on an executor.  Shared with the helper jobs, which may start
+ * after the work is done.
+ *
+ * `body` lives in the caller's frame, so an exception from it must not leave `for_each_chunk()`
+ * while helpers may still run.  The first one is kept, the remaining chunks are skipped, and it
+ * is rethrown once every chunk is accounted for.
+ */
+template <class BodyT>
+struct Chunk_Work
+{
+    Chunk_Work( std::size_t c, std::size_t n, BodyT& b )
+      : count{ c }, chunks{ n }, body{ b }
+    {}
+
+    /**
+     * @brief Claim and run chunks until none are left.  Never throws.
+     */
+    void run() noexcept
+    {
+        std::size_t chunk;
+        while( ( chunk = next.fetch_add( 1, std::memory_order_relaxed ) ) < chunks )
+        {
+            if( !thrown.load( std::memory_order_relaxed ) )
+            {
+                run_chunk( chunk );
+            }
+            if( done.fetch_add( 1, std::memory_order_acq_rel ) + 1 == chunks )
+            {
+                done.notify_one();
+            }
+        }
+    }
+
+    /**
+     * @brief Run one chunk, keeping the first exception it or any other chunk throws.
+     */
+    void run_chunk( std::size_t chunk ) noexcept
+    {
+#if defined( __cpp_exceptions )
+        try
+        {
+            body( chunk, chunk * count / chunks, ( chunk + 1 ) * count / chunks );
+        }
+        catch( ... )
+        {
+            if( !thrown.exchange( true, std::memory_order_relaxed ) )
+            {
+                exception = std::current_exception();
+            }
+        }
+#else
+        body( chunk, chunk * count / chunks, ( chunk + 1 ) * count / chunks );
+#endif
+    }
+
+    std::size_t              count;
+    std::size_t              chunks;
+    BodyT&                   body;
+    std::atomic<std::size_t> next{ 0 };
+    std::atomic<std::size_t> done{ 0 };
+    std::atomic<bool>        thrown{ false };
+    std::exception_ptr       exception;
+};
+
+/**
+ * @brief Run `body( chunk, begin, end )` over `chunks` chunks of `count` elements on
+ *        `executor`.
+ *
+ * The calling thread claims chunks too, so the call completes even if every worker is busy,
+ * including when it is made from a worker of the same pool.  If `body` throws, the first
+ * exception is rethrown after every chunk has finished or been skipped.
+ */
+template <Result_Executor ExecutorT, class BodyT>
+void for_each_chunk( ExecutorT& executor, std::size_t count, std::size_t chunks, BodyT&& body )
+{
+    if( chunks == 0 )
+    {
+        return;
+    }
+    auto work    = std::make_shared<Chunk_Work<std::remove_reference_t<BodyT>>>( count, chunks, body );
+    auto helpers = std::min( worker_count( executor ), chunks ) - 1;
+    for( std::size_t i = 0; i < helpers; ++i )
+    {
+        executor.execute( [work] { work->run(); } );
+    }
+    work->run();
+
+    auto done = work->done.load( std::memory_order_acquire );
+    while( done != chunks )
+    {
+        work->done.wait( done, std::memory_order_acquire );
+        done = work->done.load( std::memory_order_acquire );
+    }
+    if( work->exception )
+    {
+        std::rethrow_exception( work->exception );
+    }
+}
+
+/**
+ * @brief Number of chunks to split `count` elements into for `where`, a policy or executor.
+ */
+template <class WhereT>
+std::size_t chunks_for( const WhereT& where, std::size_t count ) noexcept
+{
+    std::size_t workers;
+    if constexpr ( Execution_Policy<WhereT> )
+    {
+        workers = std::is_same_v<std::remove_cvref_t<WhereT>, std::execution::sequenced_policy>
+                  ? 1
+                  : std::max( 1u, std::thread::hardware_concurrency() );
+    }
+    else
+    {
+        workers = worker_count( where );
+    }
+    return chunk_count( count, workers );
+}
+
+/**
+ * Policies and executors the algorithms accept.
+ */
+template <class WhereT>
+concept Parallel_Target = Execution_Policy<WhereT> || Result_Executor<std::remove_reference_t<WhereT>>;
+
+} // End of impl namespace
+
+/**
+ * @brief Apply `fn` to every element and gather the values, stopping at the first failure.
+ *
+ * @param where A standard execution policy or a `Result_Executor`.
+ * @param range Random access range of inputs.
+ * @param fn    Called with each element, returning `Result<U,E>`.
+ *
+ * @returns The values in input order, or the error at the lowest failing index.
+ */
+template <impl::Parallel_Target WhereT, std::ranges::random_access_range RangeT, class FuncT>
+  requires impl::Result_Traits<impl::Element_Result_T<RangeT,FuncT>>::is_result
+auto transform_results( WhereT&& where, RangeT&& range, FuncT fn )
+{
+    using TRAITS_TYPE = impl::Result_Traits<impl::Element_Result_T<RangeT,FuncT>>;
+    using VALUE_TYPE  = typename TRAITS_TYPE::value_type;
+    using ERROR_CODE  = typename TRAITS_TYPE::error_code_type;
+    static_assert( !std::is_void_v<VALUE_TYPE> && !std::is_reference_v<VALUE_TYPE>,
+                   "transform_results() needs values; use try_for_each() for Result<void>" );
+
+    const auto count = static_cast<std::size_t>( std::ranges::size( range ) );
+    auto first = std::ranges::begin( range );
+    const auto chunks = impl::chunks_for( where, count );
+    impl::Error_Latch<ERROR_CODE> latch{ chunks };
+    std::vector<std::optional<VALUE_TYPE>> slots( count );
+
+    impl::for_each_chunk( std::forward<WhereT>( where ), count, chunks,
+                          [&]( std::size_t chunk, std::size_t begin, std::size_t end )
+    {
+        for( auto i = begin; i < end && !latch.stopped_before( i ); ++i )
+        {
+            auto r = std::invoke( fn, first[i] );
+            if( r.has_error() )
+            {
+                latch.fail( chunk, i, std::move( r ).assume_error() );
+                return;
+            }
+            slots[i].emplace( std::move( r ).assume_value() );
+        }
+    } );
+
+    if( auto error = latch.take_error() )
+    {
+        return Result<std::vector<VALUE_TYPE>,ERROR_CODE>{ impl::failure( std::move( *error ) ) };
+    }
+    std::vector<VALUE_TYPE> values;
+    values.reserve( count );
+    for( auto& slot : slots )
+    {
+        values.push_back( std::move( *slot ) );
+    }
+    return Result<std::vector<VALUE_TYPE>,ERROR_CODE>{ impl::success( std::move( values ) ) };
+}
+
+/**
+ * @brief Apply `fn` to every element and keep every outcome, without stopping on failure.
+ *
+ * Use this to validate a batch of inputs and report all of the failures.
+ *
+ * @returns The result for each element, in input order.
+ */
+template <impl::Parallel_Target WhereT, std::ranges::random_access_range RangeT, class FuncT>
+  requires impl::Result_Traits<impl::Element_Result_T<RangeT,FuncT>>::is_result
+auto collect( WhereT&& where, RangeT&& range, FuncT fn )
+{
+    using RESULT_TYPE = impl::Element_Result_T<RangeT,FuncT>;
+
+    const auto count = static_cast<std::size_t>( std::ranges::size( range ) );
+    auto first = std::ranges::begin( range );
+    std::vector<std::optional<RESULT_TYPE>> slots( count );
+
+    impl::for_each_chunk( std::forward<WhereT>( where ), count, impl::chunks_for( where, count ),
+                          [&]( std::size_t, std::size_t begin, std::size_t end )
+    {
+        for( auto i = begin; i < end; ++i )
+        {
+            slots[i].emplace( std::invoke( fn, first[i] ) );
+        }
+    } );
+
+    std::vector<RESULT_TYPE> results;
+    results.reserve( count );
+    for( auto& slot : slots )
+    {
+        results.push_back( std::move( *slot ) );
+    }
+    return results;
+}
+
+/**
+ * @brief Apply `fn` to every element, stopping at the first failure.
+ *
+ * @returns Success, or the error at the lowest failing index.
+ */
+template <impl::Parallel_Target WhereT, std::ranges::random_access_range RangeT, class FuncT>
+  requires impl::Result_Traits<impl::Element_Result_T<RangeT,FuncT>>::is_result
+auto try_for_each( WhereT&& where, RangeT&& range, FuncT fn )
+{
+    using ERROR_CODE = typename impl::Result_Traits<impl::Element_Result_T<RangeT,FuncT>>::error_code_type;
+
+    const auto count = static_cast<std::size_t>( std::ranges::size( range ) );
+    auto first = std::ranges::begin( range );
+    const auto chunks = impl::chunks_for( where, count );
+    impl::Error_Latch<ERROR_CODE> latch{ chunks };
+
+    impl::for_each_chunk( std::forward<WhereT>( where ), count, chunks,
+                          [&]( std::size_t chunk, std::size_t begin, std::size_t end )
+    {
+        for( auto i = begin; i < end && !latch.stopped_before( i ); ++i )
+        {
+            auto r = std::invoke( fn, first[i] );
+            if( r.has_error() )
+            {
+                latch.fail( chunk, i, std::move( r ).assume_error() );
+                return;
+            }
+        }
+    } );
+
+    if( auto error = latch.take_error() )
+    {
+        return Result<void,ERROR_CODE>{ impl::failure( std::move( *error ) ) };
+    }
+    return Result<void,ERROR_CODE>{ impl::success() };
+}
+
+/**
+ * @brief Transform every element and combine the values, stopping at the first failure.
+ *
+ * Each chunk folds its values in index order, and the chunk totals are folded into `init` in
+ * chunk order, so `reduce` must be associative.  It need not be commutative.
+ *
+ * @param where     A standard execution policy or a `Result_Executor`.
+ * @param range     Random access range of inputs.
+ * @param init      Initial value.
+ * @param reduce    Combines two `T`s into one.
+ * @param transform Called with each element, returning `Result<U,E>` with `U` convertible to `T`.
+ *
+ * @returns The combined value, or the error at the lowest failing index.
+ */
+template <impl::Parallel_Target WhereT, std::ranges::random_access_range RangeT, class ValueT,
+          class ReduceT, class TransformT>
+  requires impl::Result_Traits<impl::Element_Result_T<RangeT,TransformT>>::is_result
+auto transform_reduce_results( WhereT&& where, RangeT&& range, ValueT init, ReduceT reduce, TransformT transform )
+{
+    using ERROR_CODE  = typename impl::Result_Traits<impl::Element_Result_T<RangeT,TransformT>>::error_code_type;
+    using RESULT_TYPE = Result<ValueT,ERROR_CODE>;
+
+    const auto count = static_cast<std::size_t>( std::ranges::size( range ) );
+    auto first = std::ranges::begin( range );
+    const auto chunks = impl::chunks_for( where, count );
+    impl::Error_Latch<ERROR_CODE> latch{ chunks };
+    std::vector<std::optional<ValueT>> partials( chunks );
+
+    impl::for_each_chunk( std::forward<WhereT>( where ), count, chunks,
+                          [&]( std::size_t chunk, std::size_t begin, std::size_t end )
+    {
+        std::optional<ValueT> partial;
+        for( auto i = begin; i < end && !latch.stopped_before( i ); ++i )
+        {
+            auto r = std::invoke( transform, first[i] );
+            if( r.has_error() )
+            {
+                latch.fail( chunk, i, std::move( r ).assume_error() );
+                return;
+            }
+            ValueT v( std::move( r ).assume_value() );
+            partial.emplace( partial ? std::invoke( reduce, std::move( *partial ), std::move( v ) ) : std::move( v ) );
+        }
+        partials[chunk] = std::move( partial );
+    } );
+
+    if( auto error = latch.take_error() )
+    {
+        return RESULT_TYPE{ impl::failure( std::move( *error ) ) };
+    }
+    for( auto& partial : partials )
+    {
+        if( partial )
+        {
+            init = std::invoke( reduce, std::move( init ), std::move( *partial ) );
+        }
+    }
+    return RESULT_TYPE{ impl::success( std::move( init ) ) };
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,934 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    coroutine.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Coroutine support for `Result`.
+ *
+ * A function returning `Result<T,E>` can be written as a coroutine.  `co_await` on a
+ * `Result<U,E>` yields its value, or returns its error from the coroutine, like
+ * `TERMINUS_OUTCOME_TRY` but usable inside expressions:
+ *
+ * @code
+ * Result<Tile,Error_Code> load_tile( Tile_Id id )
+ * {
+ *     co_return decode( co_await read_tile( id ), co_await read_palette( id ) );
+ * }
+ * @endcode
+ *
+ * These coroutines run to completion before returning.  `Task<Result<T,E>>` is the asynchronous
+ * form: it starts when awaited, and inside it `co_await` also accepts other tasks and
+ * `Result_Future`s, suspending without blocking a thread until they complete.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/impl/coroutine_return.hpp>
+#include <terminus/outcome/result.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+namespace tmns::outcome {
+
+template <class ResultT>
+class Task;
+
+namespace impl {
+
+/**
+ * @brief Build the result of a coroutine from the operand of `co_return`.
+ */
+template <class ValueT, class ErrorCodeT, class UValueT>
+Result<ValueT,ErrorCodeT> make_result( UValueT&& v )
+{
+    if constexpr ( std::is_constructible_v<Result<ValueT,ErrorCodeT>, UValueT&&> )
+    {
+        return Result<ValueT,ErrorCodeT>( std::forward<UValueT>( v ) );
+    }
+    else
+    {
+        return Result<ValueT,ErrorCodeT>( std::in_place_type<ValueT>, std::forward<UValueT>( v ) );
+    }
+}
+
+/**
+ * @brief Value produced by `co_await` on a successful result.
+ *
+ * Values are moved out of results that are awaited as rvalues and referenced in those awaited as
+ * lvalues.  References are passed through.
+ */
+template <class ResultT>
+decltype(auto) unwrap( ResultT&& r )
+{
+    using VALUE_TYPE = typename Result_Traits<std::remove_cvref_t<ResultT>>::value_type;
+    if constexpr ( std::is_void_v<VALUE_TYPE> )
+    {
+        return;
+    }
+    else if constexpr ( std::is_lvalue_reference_v<ResultT> || std::is_lvalue_reference_v<VALUE_TYPE> )
+    {
+        return ( r.assume_value() );
+    }
+    else
+    {
+        return VALUE_TYPE( std::move( r ).assume_value() );
+    }
+}
+
+/**
+ * Resumes coroutines one after another from a loop on the current thread.
+ *
+ * Control passing between tasks goes through `resume()` instead of returning a handle from
+ * `await_suspend()`.  A coroutine that suspends while the loop is resuming it leaves the next
+ * coroutine for the loop, so long runs of awaits and deep chains of tasks use a constant amount
+ * of stack at any optimization level, whether or not the compiler makes a tail call of the
+ * transfer.
+ */
+class Resume_Loop
+{
+    public:
+
+        /**
+         * @brief Resume `h`, or leave it to the loop running on this thread.  Null handles are
+         *        ignored.
+         */
+        static void resume( std::coroutine_handle<> h )
+        {
+            if( !h )
+            {
+                return;
+            }
+            // Another coroutine may already be waiting, if the one being resumed resumed others
+            if( t_next != nullptr && !*t_next )
+            {
+                *t_next = h;
+                return;
+            }
+
+            std::coroutine_handle<> next = h;
+            const Scope scope{ next };
+            while( next )
+            {
+                std::exchange( next, nullptr ).resume();
+            }
+        }
+
+    private:
+
+        /**
+         * Makes a loop the one coroutines on this thread leave their successor to.
+         */
+        class Scope
+        {
+            public:
+
+                explicit Scope( std::coroutine_handle<>& next ) noexcept
+                  : m_outer{ std::exchange( t_next, &next ) }
+                {}
+
+                Scope( const Scope& ) = delete;
+                Scope& operator = ( const Scope& ) = delete;
+
+                ~Scope()
+                {
+                    t_next = m_outer;
+                }
+
+            private:
+
+                /// Slot of the loop this one runs inside, if any
+                std::coroutine_handle<>* m_outer;
+
+        }; // End of Scope Class
+
+        /// Slot of the innermost loop running on this thread
+        static constinit inline thread_local std::coroutine_handle<>* t_next{ nullptr };
+
+}; // End of Resume_Loop Class
+
+/**
+ * Awaiter for `co_await` on a `Result`.  A value resumes the coroutine at once.  An error is
+ * handed to the promise's `abort()`, which finishes the coroutine without resuming it.
+ */
+template <class ResultT>
+class Result_Awaiter
+{
+    public:
+
+        explicit Result_Awaiter( std::remove_reference_t<ResultT>& result ) noexcept
+          : m_result{ result }
+        {}
+
+        bool await_ready() const noexcept
+        {
+            return m_result.has_value();
+        }
+
+        template <class PromiseT>
+        void await_suspend( std::coroutine_handle<PromiseT> h ) noexcept
+        {
+            Resume_Loop::resume( h.promise().abort( std::forward<ResultT>( m_result ).assume_error() ) );
+        }
+
+        decltype(auto) await_resume()
+        {
+            return unwrap( std::forward<ResultT>( m_result ) );
+        }
+
+    private:
+
+        /// Awaited result, which lives until the end of the `co_await` expression
+        std::remove_reference_t<ResultT>& m_result;
+
+}; // End of Result_Awaiter Class
+
+/**
+ * Awaiter for `co_await` on a `Result_Future`.  The coroutine is resumed by the thread storing
+ * the result.  With `PropagateV` an error finishes the coroutine like an awaited failed
+ * `Result`, otherwise the whole result is produced.
+ */
+template <class ValueT, class ErrorCodeT, bool PropagateV>
+class Future_Awaiter
+{
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+
+        explicit Future_Awaiter( Result_Future<ValueT,ErrorCodeT>&& future ) noexcept
+          : m_future{ std::move( future ) }
+        {}
+
+        bool await_ready()
+        {
+            if( !m_future.is_ready() )
+            {
+                return false;
+            }
+            m_result.emplace( m_future.get() );
+            return !PropagateV || m_result->has_value();
+        }
+
+        template <class PromiseT>
+        void await_suspend( std::coroutine_handle<PromiseT> h ) noexcept
+        {
+            if constexpr ( PropagateV )
+            {
+                if( m_result )
+                {
+                    Resume_Loop::resume( h.promise().abort( std::move( *m_result ).assume_error() ) );
+                    return;
+                }
+            }
+            // The coroutine may be resumed, and this awaiter destroyed, before attach() returns
+            Future_Access::attach( std::move( m_future ), [this, h]( RESULT_TYPE&& r )
+            {
+                if constexpr ( PropagateV )
+                {
+                    if( r.has_error() )
+                    {
+                        Resume_Loop::resume( h.promise().abort( std::move( r ).assume_error() ) );
+                        return;
+                    }
+                }
+                m_result.emplace( std::move( r ) );
+                Resume_Loop::resume( h );
+            } );
+        }
+
+        decltype(auto) await_resume()
+        {
+            if constexpr ( PropagateV )
+            {
+                return unwrap( std::move( *m_result ) );
+            }
+            else
+            {
+                return RESULT_TYPE{ std::move( *m_result ) };
+            }
+        }
+
+    private:
+
+        /// Future being awaited
+        Result_Future<ValueT,ErrorCodeT> m_future;
+
+        /// Result, once stored
+        std::optional<RESULT_TYPE> m_result;
+
+}; // End of Future_Awaiter Class
+
+/**
+ * Promise of a coroutine returning `Result<ValueT,ErrorCodeT>`.
+ *
+ * Compilers differ on when the object returned by `get_return_object()` is converted to the
+ * declared return type.  Converted after the body has run, it carries the finished result.
+ * Converted before, it constructs a placeholder `Result` that registers its address, and the
+ * result is assigned there instead.
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_Coroutine_Promise
+{
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+
+        /**
+         * Object returned from the coroutine's ramp, converted to the `Result`.
+         */
+        class Return_Object
+        {
+            public:
+
+                explicit Return_Object( Result_Coroutine_Promise& promise ) noexcept
+                  : m_promise{ &promise }
+                {
+                    promise.m_storage = &m_storage;
+                }
+
+                Return_Object( Return_Object&& rhs ) noexcept( std::is_nothrow_move_constructible_v<RESULT_TYPE> )
+                  : m_storage{ std::move( rhs.m_storage ) },
+                    m_promise{ rhs.m_promise }
+                {
+                    // Until the body has run, the promise must write here instead
+                    if( !m_storage )
+                    {
+                        m_promise->m_storage = &m_storage;
+                    }
+                }
+
+                operator RESULT_TYPE()
+                {
+                    if( m_storage )
+                    {
+                        return std::move( *m_storage );
+                    }
+                    return RESULT_TYPE{ Coroutine_Return_Tag{ &m_promise->m_target } };
+                }
+
+            private:
+
+                /// Result, once the body has run
+                std::optional<RESULT_TYPE> m_storage;
+
+                /// Promise of the coroutine.  Dangles once the body has run.
+                Result_Coroutine_Promise* m_promise;
+
+        }; // End of Return_Object Class
+
+        Return_Object get_return_object() noexcept
+        {
+            return Return_Object{ *this };
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception()
+        {
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+            std::terminate();
+#else
+            throw;
+#endif
+        }
+
+        template <class UValueT>
+        void return_value( UValueT&& v )
+        {
+            set_result( make_result<ValueT,ErrorCodeT>( std::forward<UValueT>( v ) ) );
+        }
+
+        /**
+         * @brief `co_await` on a `Result` with the same error code type.
+         */
+        template <class ResultT>
+          requires std::same_as<typename Result_Traits<std::remove_cvref_t<ResultT>>::error_code_type, ErrorCodeT>
+        Result_Awaiter<ResultT> await_transform( ResultT&& result ) const noexcept
+        {
+            return Result_Awaiter<ResultT>{ result };
+        }
+
+        /**
+         * @brief Return `error` from the coroutine and destroy it.
+         *
+         * @returns Null, since there is no coroutine to resume.
+         */
+        std::coroutine_handle<> abort( Error<ErrorCodeT> error ) noexcept
+        {
+            set_result( RESULT_TYPE{ failure( std::move( error ) ) } );
+            std::coroutine_handle<Result_Coroutine_Promise>::from_promise( *this ).destroy();
+            return nullptr;
+        }
+
+    private:
+
+        void set_result( RESULT_TYPE&& result )
+        {
+            if( m_target != nullptr )
+            {
+                *static_cast<RESULT_TYPE*>( m_target ) = std::move( result );
+            }
+            else
+            {
+                m_storage->emplace( std::move( result ) );
+            }
+        }
+
+        /// Storage in the return object, when it has not been converted yet
+        std::optional<RESULT_TYPE>* m_storage{ nullptr };
+
+        /// Placeholder `Result`, when the return object has already been converted
+        void* m_target{ nullptr };
+
+}; // End of Result_Coroutine_Promise Class
+
+template <class ValueT, class ErrorCodeT, bool PropagateV>
+class Task_Awaiter;
+
+/**
+ * Part of a task's promise that does not depend on its value type.  It links a task to the task
+ * awaiting it, so a failure can be handed straight to the outermost task that is finished by it.
+ */
+template <class ErrorCodeT>
+class Task_Promise_Base
+{
+    public:
+
+        Task_Promise_Base( const Task_Promise_Base& ) = delete;
+        Task_Promise_Base& operator = ( const Task_Promise_Base& ) = delete;
+
+        /**
+         * @brief Finish this task with `error`.  If failures propagate to the task awaiting it,
+         *        finish that one instead, and so on up the chain, without resuming any of them.
+         *
+         * @returns The coroutine to resume next, or null.
+         */
+        std::coroutine_handle<> finish_with( Error<ErrorCodeT>&& error ) noexcept
+        {
+            auto* target = this;
+            while( target->m_parent != nullptr )
+            {
+                target = target->m_parent;
+            }
+            target->m_store_error( *target, std::move( error ) );
+            return target->m_continuation;
+        }
+
+        /**
+         * @brief Resume `continuation` once the result is stored.
+         */
+        void set_continuation( std::coroutine_handle<> continuation ) noexcept
+        {
+            m_continuation = continuation;
+        }
+
+        /**
+         * @brief Finish `parent` with the error instead of resuming it, if this task fails.
+         */
+        void propagate_to( Task_Promise_Base& parent ) noexcept
+        {
+            m_parent = &parent;
+        }
+
+        /**
+         * @brief Record the task this one is suspended on, whose frame is `frame`.
+         */
+        void await_child( Task_Promise_Base& child, std::coroutine_handle<> frame ) noexcept
+        {
+            m_child       = &child;
+            m_child_frame = frame;
+        }
+
+        /**
+         * @brief Called as the awaiter owning the child goes away.
+         *
+         * @returns False if `destroy_chain()` took the child, so the awaiter must not destroy it.
+         */
+        bool release_child() noexcept
+        {
+            m_child       = nullptr;
+            m_child_frame = nullptr;
+            return !std::exchange( m_child_taken, false );
+        }
+
+        /**
+         * @brief Destroy the task `frame`, whose promise is `promise`, and the chain of tasks it
+         *        is suspended on.
+         *
+         * Each task's frame owns the one it awaits, so destroying a long chain one frame inside
+         * another would recurse.  Instead, each child is taken from its awaiter before the frame
+         * holding it is destroyed, and destroyed next.
+         */
+        static void destroy_chain( Task_Promise_Base* promise, std::coroutine_handle<> frame ) noexcept
+        {
+            while( frame )
+            {
+                auto* child       = std::exchange( promise->m_child, nullptr );
+                auto  child_frame = std::exchange( promise->m_child_frame, nullptr );
+                promise->m_child_taken = ( child != nullptr );
+                frame.destroy();
+
+                promise = child;
+                frame   = child_frame;
+            }
+        }
+
+    protected:
+
+        using STORE_ERROR = void (*)( Task_Promise_Base&, Error<ErrorCodeT>&& ) noexcept;
+
+        explicit Task_Promise_Base( STORE_ERROR store_error ) noexcept
+          : m_store_error{ store_error }
+        {}
+
+        ~Task_Promise_Base() = default;
+
+        /// Coroutine awaiting this task
+        std::coroutine_handle<> m_continuation;
+
+        /// Promise of the awaiting task, when failures propagate to it
+        Task_Promise_Base* m_parent{ nullptr };
+
+        /// Promise of the task this one is suspended on
+        Task_Promise_Base* m_child{ nullptr };
+
+        /// Frame of the task this one is suspended on, owned by the awaiter
+        std::coroutine_handle<> m_child_frame;
+
+        /// Set when `destroy_chain()` has taken the child from its awaiter
+        bool m_child_taken{ false };
+
+        /// Stores an error as the result of the derived promise
+        STORE_ERROR m_store_error;
+
+}; // End of Task_Promise_Base Class
+
+/**
+ * Promise of a `Task<Result<ValueT,ErrorCodeT>>`.
+ *
+ * When the task finishes, the awaiting coroutine is resumed from the `Resume_Loop`.  A failure
+ * awaited inside the task finishes it the same way, so errors travel up a chain of tasks
+ * without resuming the tasks in between.
+ */
+template <class ValueT, class ErrorCodeT>
+class Task_Promise : public Task_Promise_Base<ErrorCodeT>
+{
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+
+        Task_Promise() noexcept
+          : Task_Promise_Base<ErrorCodeT>{ &store_error }
+        {}
+
+        Task<RESULT_TYPE> get_return_object() noexcept
+        {
+            return Task<RESULT_TYPE>{ std::coroutine_handle<Task_Promise>::from_promise( *this ) };
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        auto final_suspend() const noexcept
+        {
+            struct Final_Awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend( std::coroutine_handle<Task_Promise> h ) const noexcept
+                {
+                    Resume_Loop::resume( h.promise().complete() );
+                }
+
+                void await_resume() const noexcept {}
+            };
+            return Final_Awaiter{};
+        }
+
+        void unhandled_exception()
+        {
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+            std::terminate();
+#else
+            throw;
+#endif
+        }
+
+        template <class UValueT>
+        void return_value( UValueT&& v )
+        {
+            m_result.emplace( make_result<ValueT,ErrorCodeT>( std::forward<UValueT>( v ) ) );
+        }
+
+        /**
+         * @brief `co_await` on a `Result` with the same error code type.
+         */
+        template <class ResultT>
+          requires std::same_as<typename Result_Traits<std::remove_cvref_t<ResultT>>::error_code_type, ErrorCodeT>
+        Result_Awaiter<ResultT> await_transform( ResultT&& result ) const noexcept
+        {
+            return Result_Awaiter<ResultT>{ result };
+        }
+
+        /**
+         * @brief `co_await` on a task with the same error code type.
+         */
+        template <class UValueT>
+        Task_Awaiter<UValueT,ErrorCodeT,true> await_transform( Task<Result<UValueT,ErrorCodeT>>&& task ) const noexcept
+        {
+            return Task_Awaiter<UValueT,ErrorCodeT,true>{ std::move( task ) };
+        }
+
+        /**
+         * @brief `co_await` on a future with the same error code type.
+         */
+        template <class UValueT>
+        Future_Awaiter<UValueT,ErrorCodeT,true> await_transform( Result_Future<UValueT,ErrorCodeT>&& future ) const noexcept
+        {
+            return Future_Awaiter<UValueT,ErrorCodeT,true>{ std::move( future ) };
+        }
+
+        /**
+         * @brief Any other awaitable, including those returned by `as_result()`.
+         */
+        template <class AwaitableT>
+        AwaitableT&& await_transform( AwaitableT&& awaitable ) const noexcept
+        {
+            return std::forward<AwaitableT>( awaitable );
+        }
+
+        /**
+         * @brief Finish the task with `error`.
+         *
+         * @returns The coroutine to resume next, or null.
+         */
+        std::coroutine_handle<> abort( Error<ErrorCodeT> error ) noexcept
+        {
+            return this->finish_with( std::move( error ) );
+        }
+
+        /**
+         * @brief Coroutine to resume once the result is stored, or null.  A failure awaited by a
+         *        task goes to that task's awaiter instead of resuming it.
+         */
+        std::coroutine_handle<> complete() noexcept
+        {
+            if( this->m_parent != nullptr && m_result->has_error() )
+            {
+                return this->m_parent->finish_with( std::move( *m_result ).assume_error() );
+            }
+            return this->m_continuation;
+        }
+
+        /**
+         * @brief Access the stored result.  Only valid once the task has finished.
+         */
+        RESULT_TYPE& result() noexcept
+        {
+            return *m_result;
+        }
+
+    private:
+
+        static void store_error( Task_Promise_Base<ErrorCodeT>& promise, Error<ErrorCodeT>&& error ) noexcept
+        {
+            static_cast<Task_Promise&>( promise ).m_result.emplace( failure( std::move( error ) ) );
+        }
+
+        /// Result, once the task has finished
+        std::optional<RESULT_TYPE> m_result;
+
+}; // End of Task_Promise Class
+
+/**
+ * Awaiter for `co_await` on a `Task`, which starts the task from the `Resume_Loop`.  With
+ * `PropagateV` a failure finishes the awaiting task, otherwise the whole result is produced.
+ */
+template <class ValueT, class ErrorCodeT, bool PropagateV>
+class Task_Awaiter
+{
+    public:
+
+        explicit Task_Awaiter( Task<Result<ValueT,ErrorCodeT>>&& task ) noexcept
+          : m_task{ std::move( task ) }
+        {}
+
+        Task_Awaiter( Task_Awaiter&& ) noexcept = default;
+        Task_Awaiter& operator = ( Task_Awaiter&& ) = delete;
+
+        /**
+         * @brief Destructor.  Destroys the task, unless destroying the awaiting task already did.
+         */
+        ~Task_Awaiter()
+        {
+            if( m_parent != nullptr && !m_parent->release_child() )
+            {
+                m_task.m_handle = nullptr;
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <class PromiseT>
+        void await_suspend( std::coroutine_handle<PromiseT> h ) noexcept
+        {
+            auto& promise = m_task.m_handle.promise();
+            promise.set_continuation( h );
+            if constexpr ( PropagateV )
+            {
+                promise.propagate_to( h.promise() );
+            }
+            if constexpr ( std::derived_from<PromiseT,Task_Promise_Base<ErrorCodeT>> )
+            {
+                m_parent = &h.promise();
+                m_parent->await_child( promise, m_task.m_handle );
+            }
+            Resume_Loop::resume( m_task.m_handle );
+        }
+
+        decltype(auto) await_resume()
+        {
+            auto& result = m_task.m_handle.promise().result();
+            if constexpr ( PropagateV )
+            {
+                return unwrap( std::move( result ) );
+            }
+            else
+            {
+                return Result<ValueT,ErrorCodeT>{ std::move( result ) };
+            }
+        }
+
+    private:
+
+        /// Task being awaited, destroyed with the awaiter
+        Task<Result<ValueT,ErrorCodeT>> m_task;
+
+        /// Promise of the awaiting coroutine, when it is a task
+        Task_Promise_Base<ErrorCodeT>* m_parent{ nullptr };
+
+}; // End of Task_Awaiter Class
+
+/**
+ * Fire-and-forget coroutine that drives a task started outside of a coroutine.
+ */
+struct Detached_Coroutine
+{
+    struct promise_type
+    {
+        Detached_Coroutine get_return_object() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+} // End of impl namespace
+
+/**
+ * Lazily started coroutine producing a `Result`.
+ *
+ * A task does nothing until it is awaited or started.  Awaiting it from another coroutine runs
+ * it on the awaiting thread, and the awaiting coroutine continues when it finishes.  Both are
+ * resumed from a loop rather than from inside each other, so a chain of tasks uses no threads
+ * and a constant amount of stack however deep it is.  Because the awaiting frame owns the task,
+ * compilers that support it can elide the task's frame allocation into its caller's.
+ *
+ * Inside a task, `co_await` yields the value of a `Result`, another `Task` or a `Result_Future`
+ * with the same error code type, or finishes the task with its error.  Use `as_result()` to get
+ * the whole result instead.  A task resumed by a future runs on the thread that stored the
+ * future's result.
+ *
+ * @code
+ * Task<Result<Tile,Error_Code>> load_tile( Tile_Id id )
+ * {
+ *     auto bytes = co_await read_async( id );      // Result_Future<Bytes,Error_Code>
+ *     co_return co_await decode( bytes );          // Result<Tile,Error_Code>
+ * }
+ *
+ * auto tile = load_tile( id ).start().get();
+ * @endcode
+ */
+template <class ValueT, class ErrorCodeT>
+class Task<Result<ValueT,ErrorCodeT>>
+{
+    public:
+
+        using RESULT_TYPE  = Result<ValueT,ErrorCodeT>;
+        using promise_type = impl::Task_Promise<ValueT,ErrorCodeT>;
+
+        Task( const Task& ) = delete;
+        Task& operator = ( const Task& ) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        Task( Task&& rhs ) noexcept
+          : m_handle{ std::exchange( rhs.m_handle, nullptr ) }
+        {}
+
+        /**
+         * @brief Move assignment.
+         */
+        Task& operator = ( Task&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                reset();
+                m_handle = std::exchange( rhs.m_handle, nullptr );
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor.  Destroys the coroutine, whether or not it has run.
+         */
+        ~Task()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Check whether the task refers to a coroutine.
+         */
+        bool valid() const noexcept
+        {
+            return static_cast<bool>( m_handle );
+        }
+
+        /**
+         * @brief Run the task on the calling thread until it first suspends.
+         *
+         * @returns The future receiving the task's result.  The task is consumed.
+         */
+        Result_Future<ValueT,ErrorCodeT> start() &&
+        {
+            Result_Promise<ValueT,ErrorCodeT> promise;
+            auto future = promise.get_future();
+            drive( std::move( *this ), std::move( promise ) );
+            return future;
+        }
+
+        /**
+         * @brief Await the task from a coroutine that is not a task, producing the whole result.
+         */
+        impl::Task_Awaiter<ValueT,ErrorCodeT,false> operator co_await() && noexcept
+        {
+            return impl::Task_Awaiter<ValueT,ErrorCodeT,false>{ std::move( *this ) };
+        }
+
+    private:
+
+        friend class impl::Task_Promise<ValueT,ErrorCodeT>;
+
+        template <class OtherValueT, class OtherErrorCodeT, bool PropagateV>
+        friend class impl::Task_Awaiter;
+
+        explicit Task( std::coroutine_handle<promise_type> handle ) noexcept
+          : m_handle{ handle }
+        {}
+
+        static impl::Detached_Coroutine drive( Task task, Result_Promise<ValueT,ErrorCodeT> promise )
+        {
+            promise.set_result( co_await std::move( task ) );
+        }
+
+        void reset() noexcept
+        {
+            if( m_handle )
+            {
+                auto& promise = m_handle.promise();
+                impl::Task_Promise_Base<ErrorCodeT>::destroy_chain( &promise, std::exchange( m_handle, nullptr ) );
+            }
+        }
+
+        /// Coroutine, or null when not valid
+        std::coroutine_handle<promise_type> m_handle;
+
+}; // End of Task Class
+
+/**
+ * @brief Await a task for its whole result, without finishing the awaiting task on failure.
+ */
+template <class ValueT, class ErrorCodeT>
+impl::Task_Awaiter<ValueT,ErrorCodeT,false> as_result( Task<Result<ValueT,ErrorCodeT>>&& task ) noexcept
+{
+    return impl::Task_Awaiter<ValueT,ErrorCodeT,false>{ std::move( task ) };
+}
+
+/**
+ * @brief Await a future for its whole result, without finishing the awaiting task on failure.
+ */
+template <class ValueT, class ErrorCodeT>
+impl::Future_Awaiter<ValueT,ErrorCodeT,false> as_result( Result_Future<ValueT,ErrorCodeT>&& future ) noexcept
+{
+    return impl::Future_Awaiter<ValueT,ErrorCodeT,false>{ std::move( future ) };
+}
+
+/**
+ * @brief Await a future from a coroutine that is not a task, producing the whole result.
+ */
+template <class ValueT, class ErrorCodeT>
+impl::Future_Awaiter<ValueT,ErrorCodeT,false> operator co_await( Result_Future<ValueT,ErrorCodeT>&& future ) noexcept
+{
+    return impl::Future_Awaiter<ValueT,ErrorCodeT,false>{ std::move( future ) };
+}
+
+} // End of tmns::outcome namespace
+
+/**
+ * Makes functions returning `Result` coroutines when their body uses `co_await` or `co_return`.
+ */
+template <class ValueT, class ErrorCodeT, class... ArgsT>
+struct std::coroutine_traits<tmns::outcome::Result<ValueT,ErrorCodeT>, ArgsT...>
+{
+    using promise_type = tmns::outcome::impl::Result_Coroutine_Promise<ValueT,ErrorCodeT>;
+};
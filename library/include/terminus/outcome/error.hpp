@@ -15,12 +15,171 @@
 #pragma once
 
 // C++ Includes
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <sstream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
 #include <system_error>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/error_arena.hpp>
+#include <terminus/outcome/error_category.hpp>
+#include <terminus/outcome/impl/error_counters.hpp>
+#include <terminus/outcome/impl/error_payload.hpp>
+#include <terminus/outcome/impl/error_trace.hpp>
 
 namespace tmns::outcome {
 
+namespace impl {
+
+/**
+ * Error code enumerations whose category was associated with
+ * `TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY` and provides a constexpr message table.
+ */
+template <class ErrorCodeT>
+concept Has_Message_View = requires( int c )
+{
+    { Category_Of<ErrorCodeT>::message_view( c ) } -> std::same_as<std::string_view>;
+};
+
+/**
+ * @brief Look up the message for a code without a virtual call or allocation.
+ */
+template <class ErrorCodeT>
+  requires Has_Message_View<ErrorCodeT>
+constexpr std::string_view message_view( int c ) noexcept
+{
+    return Category_Of<ErrorCodeT>::message_view( c );
+}
+
+} // End of impl namespace
+
+/// Type tag used to request deferred formatting of the error details.
+struct Deferred
+{
+    explicit constexpr Deferred() = default;
+};
+
+/// Value used to tag-construct an `Error` with deferred details.
+inline constexpr Deferred cDeferred{};
+
+
+/**
+ * Read-only view over the context frames of an `Error`, newest first.
+ *
+ * Every call to `Error::append()` adds one frame.  The last element is the details the error
+ * was constructed with, when it had any.  Use this instead of parsing `details()` when the
+ * frames should be logged as separate fields.
+ *
+ * The view is only valid as long as the error it came from (or a copy of it) is alive.
+ */
+class Error_Context
+{
+    public:
+
+        /**
+         * Forward iterator yielding the text of each frame.
+         */
+        class Iterator
+        {
+            public:
+
+                using iterator_category = std::forward_iterator_tag;
+                using value_type        = std::string_view;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = void;
+                using reference         = std::string_view;
+
+                Iterator() = default;
+
+                explicit Iterator( const impl::Error_Payload* p ) noexcept
+                  : m_frame{ p }
+                {}
+
+                std::string_view operator * () const
+                {
+                    return m_frame->frame();
+                }
+
+                Iterator& operator ++ () noexcept
+                {
+                    m_frame = m_frame->next();
+                    return *this;
+                }
+
+                Iterator operator ++ ( int ) noexcept
+                {
+                    auto tmp = *this;
+                    ++( *this );
+                    return tmp;
+                }
+
+                bool operator == ( const Iterator& ) const = default;
+
+            private:
+
+                /// Current frame, or null at the end
+                const impl::Error_Payload* m_frame{ nullptr };
+
+        }; // End of Iterator Class
+
+        /**
+         * @brief Constructor.
+         *
+         * @param newest Newest frame, or null for an error without details.
+         */
+        explicit Error_Context( const impl::Error_Payload* newest ) noexcept
+          : m_newest{ newest }
+        {}
+
+        Iterator begin() const noexcept
+        {
+            return Iterator{ m_newest };
+        }
+
+        Iterator end() const noexcept
+        {
+            return Iterator{};
+        }
+
+        /**
+         * @brief True if the error has neither details nor context.
+         */
+        bool empty() const noexcept
+        {
+            return m_newest == nullptr;
+        }
+
+        /**
+         * @brief Number of frames.  Linear in the number of frames.
+         */
+        std::size_t size() const noexcept
+        {
+            std::size_t n = 0;
+            for( auto p = m_newest; p != nullptr; p = p->next() )
+            {
+                ++n;
+            }
+            return n;
+        }
+
+    private:
+
+        /// Newest frame
+        const impl::Error_Payload* m_newest;
+
+}; // End of Error_Context Class
+
 /**
  * Error the occurred during an operation.
  *
@@ -30,13 +189,65 @@ namespace tmns::outcome {
  * first will be converted to a string and concatenated together to form the final error message.  The
  * only requirement is that the values being written are writable to a `std::ostream` as text.
  *
+ * Formatting the details requires a `std::ostringstream`, which is expensive compared to the
+ * rest of the error.  When the caller usually only inspects `code()`, construct the error with
+ * the `cDeferred` tag instead.  The arguments are then copied into the error and only formatted
+ * the first time `details()`, `message()` or `operator<<` is used.
+ *
+ * The error is a single pointer wide.  An error without details stores its code inline as a
+ * tagged integer and never allocates.  Otherwise the code and details live in an immutable,
+ * reference-counted block that is shared by every copy of the error, so propagating the error
+ * by value costs a reference count increment rather than a string copy.
+ *
+ * Payloads are allocated from `error_memory_resource()`, which can be pointed at a per-thread
+ * arena with `Scoped_Error_Arena`, or from an explicit allocator passed with `std::allocator_arg`.
+ *
+ * When `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined, errors created with `fail()` also
+ * remember the `std::source_location` of the call, which adds one more pointer to the error.
+ * See `impl::Error_Trace` for that and the optional propagation sites recorded by
+ * `TERMINUS_OUTCOME_TRY`.
+ *
  * @tparam ErrorCodeT The enumeration type containing the supported the supported set of error codes.
 */
 template <class ErrorCodeT>
+  requires std::is_error_code_enum_v<ErrorCodeT>
 class Error
 {
     public:
 
+        /**
+         * @brief Constructs an error with a code and no details.
+         *
+         * Usable in constant expressions, so tables of errors and results can be built at compile
+         * time.  Errors constructed that way are not counted and never capture a stack trace,
+         * since both happen at run time.  At run time they allocate only when the
+         * `Stacktrace_Policy` selects them or the code does not fit inline.
+         *
+         * @param ec The error code indicating what error occurred.
+         */
+        constexpr Error( ErrorCodeT ec )
+          : m_word{ tag_or_zero( static_cast<int>( ec ) ) }
+        {
+            if( std::is_constant_evaluated() )
+            {
+                if( !fits_tag( static_cast<int>( ec ) ) )
+                {
+                    code_does_not_fit_inline();
+                }
+            }
+            else
+            {
+                increment_counter( ec );
+                capture_stacktrace( error_memory_resource(), static_cast<int>( ec ) );
+                if( !fits_tag( static_cast<int>( ec ) ) )
+                {
+                    reset( impl::make_payload<impl::Details_Payload>( error_memory_resource(),
+                                                                      static_cast<int>( ec ),
+                                                                      std::string_view{} ) );
+                }
+            }
+        }
+
         /**
          * @brief Constructs an error message for the instance using the provided arguments.
          *
@@ -48,26 +259,199 @@ class Error
          */
         template <class... ArgsT>
         Error( ErrorCodeT ec, ArgsT&&... args )
-          : m_ecode{ec},
-            m_details{ static_cast<std::ostringstream&&>((std::ostringstream{} << ... << args)).str() }
+          : Error( std::allocator_arg, error_memory_resource(), ec, std::forward<ArgsT>( args )... )
+        {}
+
+        /**
+         * @brief Constructs an error, allocating its details from the provided allocator.
+         *
+         * @param alloc Allocator for the payload holding the details.
+         * @param ec  The error code indicating what error occurred.
+         * @param args The arguments used to compose the detailed error message.
+         */
+        template <class... ArgsT>
+        Error( std::allocator_arg_t, const std::pmr::polymorphic_allocator<>& alloc, ErrorCodeT ec, ArgsT&&... args )
+          : m_word{ tag_or_zero( static_cast<int>( ec ) ) }
+        {
+            increment_counter( ec );
+            capture_stacktrace( alloc.resource(), static_cast<int>( ec ) );
+            std::pmr::string details{ alloc.resource() };
+            if constexpr ( sizeof...(ArgsT) == 1 && ( std::is_convertible_v<ArgsT, std::string_view> && ... ) )
+            {
+                // Text such as the output of `fail( cFormat, ... )` needs no stream
+                details = std::string_view{ args... };
+            }
+            else if constexpr ( sizeof...(ArgsT) > 0 )
+            {
+                impl::Pmr_Ostringstream sout{ std::ios_base::out, alloc.resource() };
+                ( sout << ... << args );
+                details = std::move( sout ).str();
+            }
+            if( !details.empty() || !fits_tag( static_cast<int>( ec ) ) )
+            {
+                reset( impl::make_payload<impl::Details_Payload>( alloc.resource(),
+                                                                  static_cast<int>( ec ),
+                                                                  std::move( details ) ) );
+            }
+        }
+
+        /**
+         * @brief Constructs an error whose detailed message is formatted on first use.
+         *
+         * The arguments are decay-copied into the error.  Strings, string views and C-strings
+         * are copied as text, so they may be temporaries.  Spans are rejected at compile time.
+         * Other pointers are copied as pointers, so the data they reference must outlive the
+         * error or the first call to `details()`.
+         *
+         * @param ec  The error code indicating what error occurred.
+         * @param args The arguments used to compose the detailed error message.
+         */
+        template <class... ArgsT>
+        Error( Deferred, ErrorCodeT ec, ArgsT&&... args )
+          : Error( std::allocator_arg, error_memory_resource(), cDeferred, ec, std::forward<ArgsT>( args )... )
         {}
 
+        /**
+         * @brief Constructs an error with deferred details, allocated from the provided allocator.
+         *
+         * @param alloc Allocator for the payload holding the arguments.
+         * @param ec  The error code indicating what error occurred.
+         * @param args The arguments used to compose the detailed error message.
+         */
+        template <class... ArgsT>
+        Error( std::allocator_arg_t, const std::pmr::polymorphic_allocator<>& alloc, Deferred, ErrorCodeT ec, ArgsT&&... args )
+          : m_word{ tag_or_zero( static_cast<int>( ec ) ) }
+        {
+            increment_counter( ec );
+            capture_stacktrace( alloc.resource(), static_cast<int>( ec ) );
+            if constexpr ( sizeof...(ArgsT) > 0 )
+            {
+                reset( impl::make_payload<impl::Deferred_Payload<std::decay_t<ArgsT>...>>( alloc.resource(),
+                                                                                          static_cast<int>( ec ),
+                                                                                          std::forward<ArgsT>( args )... ) );
+            }
+            else if( !fits_tag( static_cast<int>( ec ) ) )
+            {
+                reset( impl::make_payload<impl::Details_Payload>( alloc.resource(),
+                                                                  static_cast<int>( ec ),
+                                                                  std::string_view{} ) );
+            }
+        }
+
+        /**
+         * @brief Constructs an error that remembers where it was created.  The remaining
+         *        arguments are passed on to one of the other constructors.
+         *
+         * @param where Location of the code creating the error.
+         * @param args The arguments for the other constructor.
+         */
+        template <class... ArgsT>
+        Error( const std::source_location& where, ArgsT&&... args )
+          : Error( std::forward<ArgsT>( args )... )
+        {
+            m_trace.set_origin( where );
+        }
+
+        /**
+         * @brief Copy constructor.  Shares the payload of the other error.
+         */
+        constexpr Error( const Error& rhs ) noexcept
+          : m_word{ rhs.m_word },
+            m_trace{ rhs.m_trace }
+        {
+            if( !is_tagged() )
+            {
+                payload()->retain();
+            }
+        }
+
+        /**
+         * @brief Move constructor.  The moved-from error keeps its code but loses its details.
+         */
+        constexpr Error( Error&& rhs ) noexcept
+          : m_word{ std::exchange( rhs.m_word, rhs.is_tagged() ? rhs.m_word : tag_or_zero( rhs.raw_code() ) ) },
+            m_trace{ rhs.m_trace }
+        {}
+
+        /**
+         * @brief Copy assignment operator.
+         */
+        constexpr Error& operator = ( const Error& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                Error tmp{ rhs };
+                swap( tmp );
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator.
+         */
+        constexpr Error& operator = ( Error&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                Error tmp{ std::move( rhs ) };
+                swap( tmp );
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor.  Releases the payload, if any.
+         */
+        constexpr ~Error()
+        {
+            if( !is_tagged() )
+            {
+                payload()->release();
+            }
+        }
+
         /**
          * @brief Return the error code indicating what error occurred.
          * @returns Error code that occurred based on ErrorCodeT
          */
-        const std::error_code& code() const
+        std::error_code code() const
         {
-            return m_ecode;
+            return std::error_code{ static_cast<ErrorCodeT>( raw_code() ) };
+        }
+
+        /**
+         * @brief Return the error code as its enumeration.  Unlike `code()`, usable in constant
+         *        expressions.
+         */
+        constexpr ErrorCodeT code_enum() const noexcept
+        {
+            return static_cast<ErrorCodeT>( raw_code() );
         }
 
         /**
          * @brief Return the message with additional details about the context of the error.
          * @returns The message with additional details.
          */
-        const std::string& details() const
+        std::string_view details() const
         {
-            return m_details;
+            if( is_tagged() )
+            {
+                return {};
+            }
+            return payload()->details();
+        }
+
+        /**
+         * @brief Return the details if they are available without formatting anything.
+         * @returns The details, or nothing while deferred details have not been rendered yet.
+         */
+        std::optional<std::string_view> rendered_details() const noexcept
+        {
+            if( is_tagged() )
+            {
+                return std::string_view{};
+            }
+            return payload()->rendered_details();
         }
 
         /**
@@ -76,20 +460,103 @@ class Error
          */
         std::string message() const
         {
-            auto m = m_ecode.message();
-            if( !m_details.empty() )
+            std::string m;
+            if constexpr ( impl::Has_Message_View<ErrorCodeT> )
+            {
+                m = code_message();
+            }
+            else
+            {
+                m = code().message();
+            }
+            const auto d = details();
+            if( !d.empty() )
             {
-                m += ": " + m_details;
+                m += ": ";
+                m += d;
             }
             return m;
         }
 
+        /**
+         * @brief Return the category's message for the error code, without the details.
+         *
+         * Only available when the category provides a constexpr message table, in which case
+         * this neither allocates nor makes a virtual call.
+         */
+        std::string_view code_message() const noexcept
+          requires impl::Has_Message_View<ErrorCodeT>
+        {
+            return impl::message_view<ErrorCodeT>( raw_code() );
+        }
+
+        /**
+         * @brief Return where the error was created by `fail()`.
+         *
+         * Only recorded when `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined.  Otherwise, and
+         * for errors constructed directly, returns a default location with a line of zero.
+         */
+        std::source_location origin() const noexcept
+        {
+            return m_trace.origin();
+        }
+
+        /**
+         * @brief Return the `TERMINUS_OUTCOME_TRY` sites the error passed through, oldest first.
+         *
+         * Always empty unless `TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES` is defined, and limited
+         * to the first `TERMINUS_OUTCOME_PROPAGATION_SITES` sites.
+         */
+        std::span<const std::source_location> propagation_sites() const noexcept
+        {
+            return m_trace.sites();
+        }
+
+        /**
+         * @brief Record that the error passed through a propagation site.  Does nothing unless
+         *        `TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES` is defined.
+         */
+        void add_propagation_site( const std::source_location& where ) noexcept
+        {
+            m_trace.add_site( where );
+        }
+
+        /**
+         * @brief Return the stack trace captured when the error was created.
+         *
+         * Null unless the library is built with `TERMINUS_OUTCOME_ENABLE_STACKTRACE` and the
+         * `Stacktrace_Policy` for `ErrorCodeT` selected this error.  The frames are symbolized
+         * when the trace is written to a stream.
+         */
+        const Error_Stacktrace* stacktrace() const noexcept
+        {
+            return m_trace.stacktrace();
+        }
+
+        /**
+         * @brief Return the context frames of the error, newest first.
+         */
+        Error_Context context() const noexcept
+        {
+            return Error_Context{ is_tagged() ? nullptr : payload() };
+        }
+
         /**
          * @brief Append additional information to the error message.
+         *
+         * This pushes a context frame in O(1), without copying the existing details.  The frames
+         * are joined with ": " when `details()` is first called.  Copies of the error made before
+         * the call keep their details, since the frames they share are never modified.
+         *
+         * The frame is allocated from the calling thread's `error_memory_resource()`, not from
+         * the resource of the older frames, which may belong to the thread that created the error.
         */
-        Error& append( const std::string& details )
+        Error& append( std::string_view details )
         {
-            m_details += ": " + details;
+            const impl::Error_Payload* next = is_tagged() ? nullptr : payload();
+            // The new frame takes over this error's reference to the previous payload
+            m_word = reinterpret_cast<std::uintptr_t>(
+                impl::make_payload<impl::Context_Payload>( error_memory_resource(), raw_code(), next, details ) );
             return *this;
         }
 
@@ -101,13 +568,131 @@ class Error
             return message();
         }
 
+        /**
+         * @brief Errors are equal when they hold the same error code.  Details, context frames
+         *        and diagnostics are not compared.
+         */
+        friend constexpr bool operator == ( const Error& lhs, const Error& rhs ) noexcept
+        {
+            return lhs.raw_code() == rhs.raw_code();
+        }
+
+        /**
+         * @brief Exchange the contents of two errors.
+         */
+        constexpr void swap( Error& rhs ) noexcept
+        {
+            std::swap( m_word, rhs.m_word );
+            std::swap( m_trace, rhs.m_trace );
+        }
+
     private:
 
-        /// Error code
-        std::error_code m_ecode;
+        /**
+         * @brief Check whether the code can be stored inline in the tagged word.  This is always
+         *        true on 64-bit targets, but not for very large codes on 32-bit ones.
+         */
+        static constexpr bool fits_tag( int c ) noexcept
+        {
+            return static_cast<std::intptr_t>( c ) >= INTPTR_MIN / 2
+                && static_cast<std::intptr_t>( c ) <= INTPTR_MAX / 2;
+        }
+
+        /**
+         * @brief Not constexpr on purpose.  Calling it while constructing an error in a constant
+         *        expression turns a code too large for the tagged word into a compile error.
+         */
+        static void code_does_not_fit_inline() noexcept {}
+
+        /**
+         * @brief Build the tagged word for an error code with no payload.
+         */
+        static constexpr std::uintptr_t tag( int c ) noexcept
+        {
+            return ( static_cast<std::uintptr_t>( static_cast<std::intptr_t>( c ) ) << 1 ) | 1u;
+        }
+
+        /**
+         * @brief Tagged word for the code, or a tagged zero if the code does not fit inline.
+         */
+        static constexpr std::uintptr_t tag_or_zero( int c ) noexcept
+        {
+            return fits_tag( c ) ? tag( c ) : tag( 0 );
+        }
+
+        /**
+         * @brief True if the error has no payload and stores its code inline.
+         */
+        constexpr bool is_tagged() const noexcept
+        {
+            return ( m_word & 1u ) != 0;
+        }
+
+        /**
+         * @brief Get the payload.  Only valid when the error is not tagged.
+         */
+        const impl::Error_Payload* payload() const noexcept
+        {
+            return reinterpret_cast<const impl::Error_Payload*>( m_word );
+        }
+
+        /**
+         * @brief Get the integer error code.
+         */
+        constexpr int raw_code() const noexcept
+        {
+            if( is_tagged() )
+            {
+                return static_cast<int>( static_cast<std::intptr_t>( m_word ) >> 1 );
+            }
+            return payload()->code();
+        }
+
+        /**
+         * @brief Count the error in the per-code counters.  Compiles to nothing unless
+         *        `TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS` is defined.
+         */
+        static void increment_counter( [[maybe_unused]] ErrorCodeT ec ) noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS )
+            count_error( ec );
+#endif
+        }
+
+        /**
+         * @brief Capture a stack trace if the policy for `ErrorCodeT` asks for one.  Compiles to
+         *        nothing unless `TERMINUS_OUTCOME_ENABLE_STACKTRACE` is defined.
+         *
+         * Called before the payload is allocated, so a failure here cannot leak it.  Errors the
+         * policy does not select never allocate for a trace.
+         */
+        void capture_stacktrace( [[maybe_unused]] std::pmr::memory_resource* resource, [[maybe_unused]] int c )
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+            if( Stacktrace_Policy<ErrorCodeT>::should_capture( c ) )
+            {
+                m_trace.capture_stacktrace( resource, 1 );
+            }
+#endif
+        }
+
+        /**
+         * @brief Take ownership of a new payload, releasing the current one.
+         */
+        void reset( const impl::Error_Payload* p ) noexcept
+        {
+            if( !is_tagged() )
+            {
+                payload()->release();
+            }
+            m_word = reinterpret_cast<std::uintptr_t>( p );
+        }
+
+        /// Either the tagged error code (low bit set) or a pointer to the shared payload
+        std::uintptr_t m_word;
 
-        /// Message with additional details
-        std::string m_details;
+        /// Origin and propagation sites (empty when both are disabled)
+        [[no_unique_address]] impl::Error_Trace m_trace{};
 
 }; // End of Error Class
 
@@ -116,19 +701,31 @@ class Error
  * from our custom error object.
  */
 template <class ErrorCodeT>
-inline const std::error_code& make_error_code( const Error<ErrorCodeT>& e )
+inline std::error_code make_error_code( const Error<ErrorCodeT>& e )
 {
     return e.code();
 }
 
 /**
- * Output stream operator that formats the error message and details when writing to
- * a stream.
+ * Output stream operator that writes the error message and details to a stream, one after the
+ * other rather than joined into a temporary string.
 */
 template <class ErrorCodeT>
 inline std::ostream& operator << ( std::ostream& s, const Error<ErrorCodeT>& e )
 {
-    s << e.message();
+    if constexpr ( impl::Has_Message_View<ErrorCodeT> )
+    {
+        s << e.code_message();
+    }
+    else
+    {
+        s << e.code().message();
+    }
+    const auto d = e.details();
+    if( !d.empty() )
+    {
+        s << ": " << d;
+    }
     return s;
 }
 
@@ -0,0 +1,175 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_arena.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace tmns::outcome {
+
+namespace impl {
+
+/**
+ * @brief Slot holding the memory resource used for errors created on the calling thread.
+ */
+inline std::pmr::memory_resource*& error_memory_resource_slot() noexcept
+{
+    static thread_local std::pmr::memory_resource* resource = nullptr;
+    return resource;
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Get the memory resource used to allocate error payloads on the calling thread.
+ *
+ * This is the resource installed by the innermost `Scoped_Error_Arena` on this thread, or
+ * `std::pmr::get_default_resource()` when none is installed.
+ */
+inline std::pmr::memory_resource* error_memory_resource() noexcept
+{
+    auto* resource = impl::error_memory_resource_slot();
+    return resource ? resource : std::pmr::get_default_resource();
+}
+
+/**
+ * Monotonic arena for the payloads of short-lived errors.
+ *
+ * Batch workers create and discard huge numbers of errors.  Allocating their payloads from the
+ * global heap makes every worker thread contend on the allocator.  An arena hands out memory
+ * with a pointer bump instead and gives it all back at once with `reset()`, for example between
+ * tiles.
+ *
+ * The arena is not thread-safe.  Use one per thread, such as the one returned by
+ * `Error_Arena::thread_local_instance()`, and install it with `Scoped_Error_Arena`.
+ *
+ * @warning Errors allocated from the arena must be destroyed before `reset()` is called or the
+ *          arena is destroyed.  Errors that need to escape the job (e.g. to be reported later)
+ *          should be created outside of the arena scope.
+ */
+class Error_Arena
+{
+    public:
+
+        /// Default size of the buffer the arena starts with
+        static constexpr std::size_t cDefaultInitialSize = 64 * 1024;
+
+        /**
+         * @brief Constructor
+         *
+         * @param initial_size Size of the buffer owned by the arena.  This buffer is reused after
+         *                     every `reset()`.
+         * @param upstream     Resource used once the initial buffer is exhausted.
+         */
+        explicit Error_Arena( std::size_t initial_size = cDefaultInitialSize,
+                              std::pmr::memory_resource* upstream = std::pmr::new_delete_resource() )
+          : m_buffer{ std::make_unique<std::byte[]>( initial_size ) },
+            m_resource{ m_buffer.get(), initial_size, upstream }
+        {}
+
+        Error_Arena( const Error_Arena& ) = delete;
+        Error_Arena& operator = ( const Error_Arena& ) = delete;
+
+        /**
+         * @brief Get the memory resource backed by the arena.
+         */
+        std::pmr::memory_resource* resource() noexcept
+        {
+            return &m_resource;
+        }
+
+        /**
+         * @brief Release everything allocated from the arena.
+         */
+        void reset() noexcept
+        {
+            m_resource.release();
+        }
+
+        /**
+         * @brief Get the arena owned by the calling thread.
+         */
+        static Error_Arena& thread_local_instance()
+        {
+            static thread_local Error_Arena arena;
+            return arena;
+        }
+
+    private:
+
+        /// Initial buffer, reused after every reset
+        std::unique_ptr<std::byte[]> m_buffer;
+
+        /// Bump allocator on top of the buffer
+        std::pmr::monotonic_buffer_resource m_resource;
+
+}; // End of Error_Arena Class
+
+/**
+ * Installs a memory resource for the errors created on the calling thread until the end of the
+ * enclosing scope.  Scopes nest, and the previous resource is restored on destruction.
+ *
+ * @code
+ * auto& arena = tmns::outcome::Error_Arena::thread_local_instance();
+ * for( const auto& tile : tiles )
+ * {
+ *     {
+ *         tmns::outcome::Scoped_Error_Arena scope{ arena };
+ *         process( tile );
+ *     }
+ *     arena.reset();
+ * }
+ * @endcode
+ */
+class Scoped_Error_Arena
+{
+    public:
+
+        /**
+         * @brief Install the arena's resource for this thread.
+         */
+        explicit Scoped_Error_Arena( Error_Arena& arena ) noexcept
+          : Scoped_Error_Arena{ arena.resource() }
+        {}
+
+        /**
+         * @brief Install an arbitrary memory resource for this thread.
+         */
+        explicit Scoped_Error_Arena( std::pmr::memory_resource* resource ) noexcept
+          : m_previous{ std::exchange( impl::error_memory_resource_slot(), resource ) }
+        {}
+
+        Scoped_Error_Arena( const Scoped_Error_Arena& ) = delete;
+        Scoped_Error_Arena& operator = ( const Scoped_Error_Arena& ) = delete;
+
+        /**
+         * @brief Restore the previously installed resource.
+         */
+        ~Scoped_Error_Arena()
+        {
+            impl::error_memory_resource_slot() = m_previous;
+        }
+
+    private:
+
+        /// Resource that was installed before this scope
+        std::pmr::memory_resource* m_previous;
+
+}; // End of Scoped_Error_Arena Class
+
+} // End of tmns::outcome namespace
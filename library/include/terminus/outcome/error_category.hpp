@@ -14,8 +14,13 @@
 */
 #pragma once
 
+// C++ Standard Libraries
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <system_error>
+#include <type_traits>
+#include <utility>
 
 namespace tmns::outcome {
 
@@ -37,6 +42,25 @@ namespace tmns::outcome {
  * anything else besides providing implementations for the `name_()` and `message_()` functions
  * in your derived class.
  *
+ * Instead of overriding `message_()`, the derived class can publish a constexpr table of
+ * messages indexed by code value, along with an optional message for codes outside of it:
+ *
+ * @code
+ * class IoCategory : public tmns::outcome::Error_Category<IoCategory>
+ * {
+ *     public:
+ *         static constexpr std::array<std::string_view,2> cMessages { "success", "not found" };
+ *         static constexpr std::string_view cUnknownMessage { "unknown" };
+ *     protected:
+ *         const char* name_() const noexcept override { return "Io"; }
+ * };
+ * @endcode
+ *
+ * Categories with a table get the static `message_view()` lookup, which neither allocates nor
+ * makes a virtual call.  `Error::message()`, `Error::code_message()` and `operator<<` use it
+ * whenever the table is available.  The `std::error_category::message()` override keeps working
+ * for callers that only have a `std::error_code`.
+ *
  * @tparam DerivedErrorCategoryT
  *          This type is needed so the static public `get()` function provides access to
  *          the singleton instance of your derived class.  This pattern is called CRTP.
@@ -48,11 +72,13 @@ class Error_Category : public std::error_category
 
         /**
          * @brief Returns the singleton instance of the category
+         *
+         * The instance is constant-initialized, so this is a plain address with no
+         * initialization guard, and is usable from other static initializers.
         */
-        static const DerivedErrorCategoryT& get()
+        static constexpr const DerivedErrorCategoryT& get() noexcept
         {
-            static DerivedErrorCategoryT c;
-            return c;
+            return s_instance;
         }
 
         /**
@@ -82,7 +108,39 @@ class Error_Category : public std::error_category
          */
         std::string message( int c ) const final
         {
-            return message_(c);
+            if constexpr ( requires { DerivedErrorCategoryT::cMessages; } )
+            {
+                return std::string{ message_view( c ) };
+            }
+            else
+            {
+                return message_(c);
+            }
+        }
+
+        /**
+         * @brief Returns the human readable name of the error code from the derived class's
+         *        `cMessages` table.
+         *
+         * Codes outside of the table map to `cUnknownMessage`, or "unknown" when the derived
+         * class does not define one.  The returned view refers to static storage.
+         */
+        static constexpr std::string_view message_view( int c ) noexcept
+          requires requires { DerivedErrorCategoryT::cMessages; }
+        {
+            constexpr auto& table = DerivedErrorCategoryT::cMessages;
+            if( c >= 0 && static_cast<std::size_t>( c ) < std::size( table ) )
+            {
+                return table[static_cast<std::size_t>( c )];
+            }
+            if constexpr ( requires { DerivedErrorCategoryT::cUnknownMessage; } )
+            {
+                return DerivedErrorCategoryT::cUnknownMessage;
+            }
+            else
+            {
+                return "unknown";
+            }
         }
 
     protected:
@@ -95,9 +153,13 @@ class Error_Category : public std::error_category
         /**
          * @brief Converts an integer error code into a human-readable name for the code.
          *
-         * Names are based on the integer represetation as custom error codes.
+         * Names are based on the integer represetation as custom error codes.  Not used when the
+         * derived class provides a `cMessages` table.
         */
-        virtual std::string message_( int c ) const = 0;
+        virtual std::string message_( [[maybe_unused]] int c ) const
+        {
+            return "unknown";
+        }
 
         /**
          * @brief Private due to being a singleton
@@ -109,6 +171,25 @@ class Error_Category : public std::error_category
         */
         virtual ~Error_Category() = default;
 
+    private:
+
+        /// The singleton.  Derived categories need a constexpr default constructor.
+        static const DerivedErrorCategoryT s_instance;
+
 }; // End of Error_Category Class
 
+template <class DerivedErrorCategoryT>
+constinit const DerivedErrorCategoryT Error_Category<DerivedErrorCategoryT>::s_instance{};
+
+namespace impl {
+
+/**
+ * The concrete category type associated with an error code enumeration through
+ * `TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY`.
+ */
+template <class ErrorCodeT>
+using Category_Of = std::remove_cvref_t<decltype( outcome_error_category( std::declval<ErrorCodeT>() ) )>;
+
+} // End of impl namespace
+
 } // End of tmns::outcome namespace
\ No newline at end of file
@@ -0,0 +1,124 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_counters.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/impl/error_counters.hpp>
+
+namespace tmns::outcome {
+
+namespace impl {
+
+/**
+ * @brief Write `value` as a Prometheus label value, escaping backslashes, quotes and newlines.
+ */
+inline void write_label_value( std::ostream& out, std::string_view value )
+{
+    out << '"';
+    for( char ch : value )
+    {
+        switch( ch )
+        {
+            case '\\': out << "\\\\"; break;
+            case '"':  out << "\\\""; break;
+            case '\n': out << "\\n";  break;
+            default:   out << ch;     break;
+        }
+    }
+    out << '"';
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Snapshot the error counters.
+ *
+ * Each counter is read atomically, but counters are not read at the same instant, so errors
+ * created during the snapshot may or may not be included.
+ *
+ * @returns The non-zero counters of every error code enumeration that has counted an error.
+ */
+inline std::vector<Error_Count> error_counts()
+{
+    std::vector<Error_Count> counts;
+    for( auto table = impl::Error_Counter_Table::first(); table != nullptr; table = table->next() )
+    {
+        table->snapshot( counts );
+    }
+    return counts;
+}
+
+/**
+ * @brief Write the error counters in the Prometheus text exposition format.
+ *
+ * Writes one counter family, `terminus_outcome_errors_total`, with `category`, `code` and
+ * `value` labels.
+ *
+ * @param out    Stream to write to.
+ * @param counts Counters to write, usually from `error_counts()`.
+ */
+inline void write_prometheus( std::ostream& out, const std::vector<Error_Count>& counts )
+{
+    out << "# HELP terminus_outcome_errors_total Errors created, by category and code.\n"
+        << "# TYPE terminus_outcome_errors_total counter\n";
+    for( const auto& c : counts )
+    {
+        out << "terminus_outcome_errors_total{category=";
+        impl::write_label_value( out, c.category );
+        out << ",code=";
+        impl::write_label_value( out, c.name );
+        out << ",value=\"" << c.code << "\"} " << c.count << '\n';
+    }
+}
+
+/**
+ * @brief Write the error counters to a file in the Prometheus text exposition format.
+ *
+ * The counters are written to a temporary file next to `path`, which is then renamed over it,
+ * so a collector such as the node exporter's textfile collector never reads a partial file.
+ *
+ * @returns The error that prevented writing the file, if any.
+ */
+inline std::error_code write_prometheus( const std::filesystem::path& path, const std::vector<Error_Count>& counts )
+{
+    auto temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out{ temp, std::ios::trunc };
+        if( !out )
+        {
+            return std::make_error_code( std::errc::io_error );
+        }
+        write_prometheus( out, counts );
+        out.flush();
+        if( !out )
+        {
+            return std::make_error_code( std::errc::io_error );
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename( temp, path, ec );
+    return ec;
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,323 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_domain.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/error_category.hpp>
+#include <terminus/outcome/macros.hpp>
+
+namespace tmns::outcome::impl {
+
+/**
+ * @brief Not constexpr on purpose.  Calling it while building a `Name_Index` turns the problem
+ *        into a compile error that names this function and the reason.
+ */
+inline void name_index_build_failed( [[maybe_unused]] const char* reason ) {}
+
+/**
+ * @brief Seeded FNV-1a hash with a final avalanche step, usable at compile time.
+ */
+constexpr std::uint64_t hash_name( std::string_view s, std::uint64_t seed ) noexcept
+{
+    std::uint64_t h = 14695981039346656037ull ^ ( seed * 0x9E3779B97F4A7C15ull );
+    for( char c : s )
+    {
+        h ^= static_cast<unsigned char>( c );
+        h *= 1099511628211ull;
+    }
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Compile-time perfect hash from a fixed set of names to their index.
+ *
+ * The table is built with the hash-and-displace method: names are grouped into buckets by a
+ * first hash, then each bucket (largest first) searches for a seed that sends all of its names
+ * to free slots.  A lookup is therefore two hashes, one slot read and one string comparison,
+ * with no allocation.
+ *
+ * @tparam N Number of names.
+ */
+template <std::size_t N>
+class Name_Index
+{
+    public:
+
+        /// Number of slots, kept at most half full
+        static constexpr std::size_t cSlots = std::bit_ceil( N * 2 + 1 );
+
+        /// Number of first-level buckets
+        static constexpr std::size_t cBuckets = N / 2 + 1;
+
+        /**
+         * @brief Build the index.  Fails to compile if the names contain duplicates.
+         */
+        consteval explicit Name_Index( const std::array<std::string_view,N>& names )
+          : m_names{ names }
+        {
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                for( std::size_t j = i + 1; j < N; ++j )
+                {
+                    if( names[i] == names[j] )
+                    {
+                        name_index_build_failed( "duplicate name in error domain" );
+                    }
+                }
+            }
+
+            // Group the names by bucket
+            std::array<std::size_t,N> bucket_of{};
+            std::array<std::size_t,cBuckets> sizes{};
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                bucket_of[i] = hash_name( names[i], 0 ) % cBuckets;
+                ++sizes[bucket_of[i]];
+            }
+
+            // Place the largest buckets first
+            std::array<std::size_t,cBuckets> order{};
+            for( std::size_t b = 0; b < cBuckets; ++b )
+            {
+                order[b] = b;
+            }
+            for( std::size_t i = 0; i < cBuckets; ++i )
+            {
+                for( std::size_t j = i + 1; j < cBuckets; ++j )
+                {
+                    if( sizes[order[j]] > sizes[order[i]] )
+                    {
+                        std::swap( order[i], order[j] );
+                    }
+                }
+            }
+
+            for( std::size_t b : order )
+            {
+                if( sizes[b] == 0 )
+                {
+                    break;
+                }
+                for( std::uint32_t seed = 1; ; ++seed )
+                {
+                    if( seed == 0x100000 )
+                    {
+                        name_index_build_failed( "unable to build a perfect hash for the error domain" );
+                    }
+                    if( try_place( b, seed, bucket_of ) )
+                    {
+                        m_seeds[b] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Find the index of a name.
+         */
+        constexpr std::optional<std::size_t> find( std::string_view name ) const noexcept
+        {
+            const auto b    = hash_name( name, 0 ) % cBuckets;
+            const auto slot = hash_name( name, m_seeds[b] ) & ( cSlots - 1 );
+            const auto idx  = m_slots[slot];
+            if( idx != 0 && m_names[idx - 1] == name )
+            {
+                return idx - 1;
+            }
+            return std::nullopt;
+        }
+
+    private:
+
+        /**
+         * @brief Try to place every name of a bucket using the seed.
+         */
+        consteval bool try_place( std::size_t b,
+                                  std::uint32_t seed,
+                                  const std::array<std::size_t,N>& bucket_of )
+        {
+            std::array<std::size_t,N> taken{};
+            std::size_t count = 0;
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                if( bucket_of[i] != b )
+                {
+                    continue;
+                }
+                const auto slot = hash_name( m_names[i], seed ) & ( cSlots - 1 );
+                if( m_slots[slot] != 0 )
+                {
+                    return false;
+                }
+                for( std::size_t k = 0; k < count; ++k )
+                {
+                    if( taken[k] == slot )
+                    {
+                        return false;
+                    }
+                }
+                taken[count++] = slot;
+            }
+
+            std::size_t k = 0;
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                if( bucket_of[i] == b )
+                {
+                    m_slots[taken[k++]] = static_cast<std::uint32_t>( i + 1 );
+                }
+            }
+            return true;
+        }
+
+        /// Names, indexed by value
+        std::array<std::string_view,N> m_names;
+
+        /// Displacement seed for each bucket
+        std::array<std::uint32_t,cBuckets> m_seeds{};
+
+        /// Index of the name in each slot, plus one (zero marks an empty slot)
+        std::array<std::uint32_t,cSlots> m_slots{};
+
+}; // End of Name_Index Class
+
+/**
+ * Error code enumerations whose category was generated by `TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN`.
+ */
+template <class ErrorCodeT>
+concept Has_Name_Table = requires( std::string_view s )
+{
+    { Category_Of<ErrorCodeT>::cNames.size() } -> std::convertible_to<std::size_t>;
+    { Category_Of<ErrorCodeT>::cNameIndex.find( s ) } -> std::same_as<std::optional<std::size_t>>;
+};
+
+} // End of tmns::outcome::impl namespace
+
+namespace tmns::outcome {
+
+/**
+ * @brief Number of codes in an error domain.
+ */
+template <class ErrorCodeT>
+  requires impl::Has_Name_Table<ErrorCodeT>
+constexpr std::size_t error_code_count() noexcept
+{
+    return impl::Category_Of<ErrorCodeT>::cNames.size();
+}
+
+/**
+ * @brief Get the enumerator name of a code, or an empty view if the code is out of range.
+ */
+template <class ErrorCodeT>
+  requires impl::Has_Name_Table<ErrorCodeT>
+constexpr std::string_view error_code_name( ErrorCodeT ec ) noexcept
+{
+    constexpr auto& names = impl::Category_Of<ErrorCodeT>::cNames;
+    const auto c = static_cast<std::underlying_type_t<ErrorCodeT>>( ec );
+    if( c < 0 || static_cast<std::size_t>( c ) >= names.size() )
+    {
+        return {};
+    }
+    return names[static_cast<std::size_t>( c )];
+}
+
+/**
+ * @brief Parse an enumerator name back into the code.
+ *
+ * Uses the domain's compile-time perfect hash, so parsing codes out of configuration files or
+ * logs is constant time and does not allocate.
+ *
+ * @returns The matching code, or `std::nullopt` if the name is not part of the domain.
+ */
+template <class ErrorCodeT>
+  requires impl::Has_Name_Table<ErrorCodeT>
+constexpr std::optional<ErrorCodeT> parse_error_code( std::string_view name ) noexcept
+{
+    if( const auto idx = impl::Category_Of<ErrorCodeT>::cNameIndex.find( name ) )
+    {
+        return static_cast<ErrorCodeT>( *idx );
+    }
+    return std::nullopt;
+}
+
+} // End of tmns::outcome namespace
+
+/**
+ * Helper macros that expand one entry of an error domain list.
+ */
+#define __TERMINUS_OUTCOME_DOMAIN_ENUMERATOR( Name, Message ) Name,
+#define __TERMINUS_OUTCOME_DOMAIN_NAME( Name, Message ) std::string_view{ #Name },
+#define __TERMINUS_OUTCOME_DOMAIN_MESSAGE( Name, Message ) std::string_view{ Message },
+
+/**
+ * Generates a complete error domain from a single list: the error code enumeration, its
+ * error category with constexpr name and message tables and a perfect hash over the names, the
+ * `make_error_code()` association, and the `std::is_error_code_enum` marker.
+ *
+ * The list is an "X-macro" taking the name of a macro and calling it once per code with the
+ * enumerator name and its message.  Codes are numbered densely from zero in list order.
+ *
+ * @code
+ * #define IO_ERROR_CODES( X )           \
+ *     X( SUCCESS,   "success" )         \
+ *     X( BAD_READ,  "bad read" )        \
+ *     X( NOT_FOUND, "not found" )
+ *
+ * TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN( io, IoErrorCode, IoErrorCategory, "IoError", IO_ERROR_CODES )
+ *
+ * auto code = tmns::outcome::parse_error_code<io::IoErrorCode>( "NOT_FOUND" );
+ * @endcode
+ *
+ * @note This macro must be used at global scope, because the marker has to specialize a
+ *       template in namespace `std`.  The enumeration and category are placed in `Namespace`,
+ *       which must be a named (possibly nested) namespace.
+ *
+ * @param Namespace      Namespace to define the enumeration and category in.
+ * @param ErrorCodeT     Name of the enum class to generate.
+ * @param ErrorCategoryT Name of the error category class to generate.
+ * @param CategoryName   String literal returned by the category's `name()`.
+ * @param List           X-macro listing the codes as `X( NAME, "message" )`.
+*/
+#define TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN( Namespace, ErrorCodeT, ErrorCategoryT, CategoryName, List )   \
+    namespace Namespace {                                                                                 \
+    enum class ErrorCodeT : int { List( __TERMINUS_OUTCOME_DOMAIN_ENUMERATOR ) };                         \
+    class ErrorCategoryT : public ::tmns::outcome::Error_Category<ErrorCategoryT>                         \
+    {                                                                                                     \
+        public:                                                                                           \
+            static constexpr std::array cNames { List( __TERMINUS_OUTCOME_DOMAIN_NAME ) };                \
+            static constexpr std::array cMessages { List( __TERMINUS_OUTCOME_DOMAIN_MESSAGE ) };          \
+            static constexpr ::tmns::outcome::impl::Name_Index<cNames.size()> cNameIndex{ cNames };       \
+            static constexpr std::string_view cUnknownMessage { "UNKNOWN" };                              \
+        protected:                                                                                        \
+            const char* name_() const noexcept override { return CategoryName; }                          \
+    };                                                                                                    \
+    TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY( ErrorCategoryT, ErrorCodeT )                               \
+    }                                                                                                     \
+    TERMINUS_OUTCOME_MARK_ENUM( Namespace::ErrorCodeT ) static_assert( true )
@@ -0,0 +1,357 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_observer.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/impl/cache_line.hpp>
+#include <terminus/outcome/impl/error_observer.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Fixed-size record of an error kept by `Error_Ring_Buffer`.  Trivially copyable, and laid out
+ * without padding in 128 bytes.
+ */
+struct Error_Record
+{
+    /// Bytes of the details kept
+    static constexpr std::size_t cDetails_Size = 85;
+
+    /// When the error was created
+    std::chrono::system_clock::time_point time;
+
+    /// Category of the code
+    const std::error_category* category;
+
+    /// File of the `fail()` or `panic()` call
+    const char* file;
+
+    /// Thread that created the error
+    std::thread::id thread;
+
+    /// Code value
+    std::int32_t code;
+
+    /// Line of the `fail()` or `panic()` call
+    std::uint32_t line;
+
+    /// What created the error
+    Error_Event::Kind kind;
+
+    /// Bytes used in `details_prefix`
+    std::uint8_t details_size;
+
+    /// True if the details were deferred and not formatted, so none were kept
+    bool details_deferred;
+
+    /// First bytes of the details
+    std::array<char,cDetails_Size> details_prefix;
+
+    /**
+     * @brief The code, with its category.
+     */
+    std::error_code error_code() const noexcept
+    {
+        return std::error_code( code, *category );
+    }
+
+    /**
+     * @brief The beginning of the details, truncated to `cDetails_Size` bytes.
+     */
+    std::string_view details() const noexcept
+    {
+        return std::string_view( details_prefix.data(), details_size );
+    }
+};
+
+/**
+ * Observer keeping the most recent errors in a fixed ring of records.
+ *
+ * Recording never allocates or locks: a writer takes a ticket from an atomic counter and fills
+ * the slot it maps to under a per-slot sequence number.  When the ring is full the oldest records
+ * are overwritten.  Readers copy records out and use the sequence number to discard any that
+ * were overwritten meanwhile, so `recent()` can be called from a signal handler, and one
+ * background consumer can `drain()` the records as they arrive.
+ *
+ * @code
+ * static tmns::outcome::Error_Ring_Buffer recent_errors{ 1024 };
+ * tmns::outcome::set_error_observer( &recent_errors );
+ * @endcode
+ */
+class Error_Ring_Buffer final : public Error_Observer
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Number of records kept, rounded up to a power of two.
+         */
+        explicit Error_Ring_Buffer( std::size_t capacity = 256 )
+          : m_mask{ std::bit_ceil( std::max<std::size_t>( capacity, 1 ) ) - 1 },
+            m_slots{ std::make_unique<Slot[]>( m_mask + 1 ) }
+        {}
+
+        Error_Ring_Buffer( const Error_Ring_Buffer& ) = delete;
+        Error_Ring_Buffer& operator = ( const Error_Ring_Buffer& ) = delete;
+
+        /**
+         * @brief Number of records kept.
+         */
+        std::size_t capacity() const noexcept
+        {
+            return m_mask + 1;
+        }
+
+        /**
+         * @brief Record `event`.
+         */
+        void on_error( const Error_Event& event ) noexcept override
+        {
+            Error_Record record{};
+            record.time     = std::chrono::system_clock::now();
+            record.category = &event.code.category();
+            record.file     = event.where.file_name();
+            record.thread   = std::this_thread::get_id();
+            record.code     = event.code.value();
+            record.line     = event.where.line();
+            record.kind     = event.kind;
+            record.details_deferred = event.details_deferred;
+            const auto size = std::min( event.details.size(), Error_Record::cDetails_Size );
+            std::copy_n( event.details.data(), size, record.details_prefix.data() );
+            record.details_size = static_cast<std::uint8_t>( size );
+            push( record );
+        }
+
+        /**
+         * @brief Copy the most recent records, oldest first.  Safe to call from a signal handler.
+         *
+         * @param out Destination.  At most `out.size()` records are copied.
+         *
+         * @returns Number of records copied.
+         */
+        std::size_t recent( std::span<Error_Record> out ) const noexcept
+        {
+            const auto head  = m_head.load( std::memory_order_acquire );
+            const auto count = std::min<std::uint64_t>( { head, capacity(), out.size() } );
+            std::size_t copied = 0;
+            for( auto ticket = head - count; ticket < head; ++ticket )
+            {
+                if( read( ticket, out[copied] ) == Read_Status::READY )
+                {
+                    ++copied;
+                }
+            }
+            return copied;
+        }
+
+        /**
+         * @brief Pass the records written since the last call to `fn`, oldest first.
+         *
+         * Only one thread may drain.  Records overwritten or dropped before they were drained are
+         * counted in `lost()`.  A record still being written ends the drain; the next call
+         * resumes there.
+         *
+         * @param fn Called with each `const Error_Record&`.
+         *
+         * @returns Number of records passed to `fn`.
+         */
+        template <class FuncT>
+        std::size_t drain( FuncT&& fn )
+        {
+            const auto head = m_head.load( std::memory_order_acquire );
+            if( head - m_tail > capacity() )
+            {
+                m_lost.fetch_add( head - m_tail - capacity(), std::memory_order_relaxed );
+                m_tail = head - capacity();
+            }
+            std::size_t drained = 0;
+            Error_Record record;
+            for( ; m_tail < head; ++m_tail )
+            {
+                const auto status = read( m_tail, record );
+                if( status == Read_Status::PENDING )
+                {
+                    break;
+                }
+                if( status == Read_Status::LOST )
+                {
+                    m_lost.fetch_add( 1, std::memory_order_relaxed );
+                    continue;
+                }
+                fn( std::as_const( record ) );
+                ++drained;
+            }
+            return drained;
+        }
+
+        /**
+         * @brief Number of records `drain()` skipped because they were overwritten before it got
+         *        to them, or dropped because another writer still held their slot.
+         */
+        std::uint64_t lost() const noexcept
+        {
+            return m_lost.load( std::memory_order_relaxed );
+        }
+
+    private:
+
+        /// Words of a record
+        static constexpr std::size_t cWords = sizeof( Error_Record ) / sizeof( std::uint64_t );
+
+        static_assert( std::is_trivially_copyable_v<Error_Record> && sizeof( Error_Record ) == 128,
+                       "Error_Record must be copied as whole words, without padding" );
+        static_assert( std::atomic<std::uint64_t>::is_always_lock_free,
+                       "Error_Ring_Buffer needs lock-free 64-bit atomics to be signal safe" );
+
+        /// Sequence phases of a slot, added to `4 * ( ticket + 1 )`
+        static constexpr std::uint64_t cPhase_Dropped = 0; ///< Ticket dropped, slot free
+        static constexpr std::uint64_t cPhase_Writing = 1; ///< Ticket being written
+        static constexpr std::uint64_t cPhase_Written = 2; ///< Ticket complete
+        static constexpr std::uint64_t cPhase_Busy    = 3; ///< Ticket dropped, older writer still in the slot
+        static constexpr std::uint64_t cPhase_Mask    = 3;
+
+        /**
+         * One record, guarded by a sequence number `4 * ( t + 1 ) + phase` naming the last ticket
+         * `t` to claim the slot.  Sequences only grow, so a reader finding a larger one than it
+         * expects knows its ticket is gone.  The record is stored as relaxed atomic words so
+         * readers racing with a writer see torn data rather than undefined behavior, and then
+         * reject it.
+         */
+        struct alignas( impl::cCache_Line_Size ) Slot
+        {
+            std::atomic<std::uint64_t>                    sequence{ 0 };
+            std::array<std::atomic<std::uint64_t>,cWords> words{};
+        };
+
+        enum class Read_Status
+        {
+            READY,
+            PENDING,
+            LOST
+        };
+
+        /**
+         * @brief Sequence of `ticket` in `phase`.
+         */
+        static constexpr std::uint64_t sequence_of( std::uint64_t ticket, std::uint64_t phase ) noexcept
+        {
+            return 4 * ( ticket + 1 ) + phase;
+        }
+
+        void push( const Error_Record& record ) noexcept
+        {
+            const auto ticket = m_head.fetch_add( 1, std::memory_order_relaxed );
+            auto& slot = m_slots[ticket & m_mask];
+
+            // Claim the slot, unless a newer ticket already has.  If an older writer is still in
+            // it, possibly the very thread this call interrupted, mark this ticket as dropped and
+            // leave the slot to that writer, which publishes the drop when it finishes.
+            const auto writing = sequence_of( ticket, cPhase_Writing );
+            auto sequence = slot.sequence.load( std::memory_order_relaxed );
+            bool busy = false;
+            do
+            {
+                if( sequence >= sequence_of( ticket, cPhase_Dropped ) )
+                {
+                    return;
+                }
+                const auto phase = sequence & cPhase_Mask;
+                busy = phase == cPhase_Writing || phase == cPhase_Busy;
+            }
+            while( !slot.sequence.compare_exchange_weak( sequence,
+                                                         busy ? sequence_of( ticket, cPhase_Busy ) : writing,
+                                                         std::memory_order_relaxed ) );
+            if( busy )
+            {
+                return;
+            }
+            std::atomic_thread_fence( std::memory_order_release );
+
+            const auto words = std::bit_cast<std::array<std::uint64_t,cWords>>( record );
+            for( std::size_t i = 0; i < cWords; ++i )
+            {
+                slot.words[i].store( words[i], std::memory_order_relaxed );
+            }
+
+            // Publish the record, or the drop of a newer ticket that found the slot busy
+            sequence = writing;
+            while( !slot.sequence.compare_exchange_weak( sequence,
+                                                         sequence == writing ? sequence_of( ticket, cPhase_Written )
+                                                                             : sequence - cPhase_Busy + cPhase_Dropped,
+                                                         std::memory_order_release,
+                                                         std::memory_order_relaxed ) )
+            {}
+        }
+
+        Read_Status read( std::uint64_t ticket, Error_Record& record ) const noexcept
+        {
+            const auto& slot = m_slots[ticket & m_mask];
+            const auto expected = sequence_of( ticket, cPhase_Written );
+            const auto before = slot.sequence.load( std::memory_order_acquire );
+            if( before != expected )
+            {
+                return before > expected || before == sequence_of( ticket, cPhase_Dropped ) ? Read_Status::LOST
+                                                                                           : Read_Status::PENDING;
+            }
+
+            std::array<std::uint64_t,cWords> words;
+            for( std::size_t i = 0; i < cWords; ++i )
+            {
+                words[i] = slot.words[i].load( std::memory_order_relaxed );
+            }
+            std::atomic_thread_fence( std::memory_order_acquire );
+            if( slot.sequence.load( std::memory_order_relaxed ) != expected )
+            {
+                return Read_Status::LOST;
+            }
+            record = std::bit_cast<Error_Record>( words );
+            return Read_Status::READY;
+        }
+
+        /// Capacity minus one
+        std::size_t m_mask;
+
+        /// Slots of the ring
+        std::unique_ptr<Slot[]> m_slots;
+
+        /// Next ticket to hand to a writer
+        alignas( impl::cCache_Line_Size ) std::atomic<std::uint64_t> m_head{ 0 };
+
+        /// Records skipped by `drain()`
+        std::atomic<std::uint64_t> m_lost{ 0 };
+
+        /// Next ticket to drain
+        std::uint64_t m_tail{ 0 };
+
+}; // End of Error_Ring_Buffer Class
+
+} // End of tmns::outcome namespace
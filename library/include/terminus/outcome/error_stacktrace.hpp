@@ -0,0 +1,274 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_stacktrace.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <version>
+
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+    #if defined( __cpp_lib_stacktrace )
+        #include <stacktrace>
+    #else
+        // Boost Libraries
+        #include <boost/stacktrace.hpp>
+    #endif
+#endif
+
+/**
+ * Maximum number of frames captured for an `Error` when `TERMINUS_OUTCOME_ENABLE_STACKTRACE`
+ * is defined.
+ */
+#if !defined( TERMINUS_OUTCOME_STACKTRACE_DEPTH )
+    #define TERMINUS_OUTCOME_STACKTRACE_DEPTH 64
+#endif
+
+namespace tmns::outcome {
+
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+
+/**
+ * Stack trace captured when an `Error` was created.
+ *
+ * Only the raw return addresses are captured.  Frames are resolved to function names and
+ * source lines when the trace is written to a stream or converted to a string, so errors that
+ * are handled without being logged never pay for symbolization.
+ *
+ * Uses `std::stacktrace` when the standard library provides it, and Boost.Stacktrace otherwise.
+ */
+class Error_Stacktrace
+{
+    public:
+
+#if defined( __cpp_lib_stacktrace )
+        using Backend = std::stacktrace;
+#else
+        using Backend = boost::stacktrace::stacktrace;
+#endif
+
+        /**
+         * @brief Capture the current stack.
+         *
+         * @param skip Number of innermost frames to leave out, not counting this function.
+         */
+        static Error_Stacktrace capture( std::size_t skip = 0 )
+        {
+#if defined( __cpp_lib_stacktrace )
+            return Error_Stacktrace{ std::stacktrace::current( skip + 1, TERMINUS_OUTCOME_STACKTRACE_DEPTH ) };
+#else
+            return Error_Stacktrace{ boost::stacktrace::stacktrace( skip + 1, TERMINUS_OUTCOME_STACKTRACE_DEPTH ) };
+#endif
+        }
+
+        /**
+         * @brief Constructor.
+         */
+        explicit Error_Stacktrace( Backend frames ) noexcept
+          : m_frames{ std::move( frames ) }
+        {}
+
+        /**
+         * @brief Get the captured frames.
+         */
+        const Backend& frames() const noexcept
+        {
+            return m_frames;
+        }
+
+        /**
+         * @brief Number of captured frames.
+         */
+        std::size_t size() const noexcept
+        {
+            return m_frames.size();
+        }
+
+        /**
+         * @brief Symbolize the frames into a multi-line string.
+         */
+        std::string to_string() const
+        {
+            std::ostringstream sout;
+            sout << m_frames;
+            return std::move( sout ).str();
+        }
+
+    private:
+
+        /// Raw frames
+        Backend m_frames;
+
+}; // End of Error_Stacktrace Class
+
+/**
+ * Output stream operator that symbolizes and writes the frames.
+ */
+inline std::ostream& operator << ( std::ostream& s, const Error_Stacktrace& trace )
+{
+    return s << trace.frames();
+}
+
+#else
+
+/// Stack traces are disabled, so `Error::stacktrace()` always returns null.
+class Error_Stacktrace;
+
+#endif
+
+/**
+ * Controls which errors with codes of type `ErrorCodeT` capture a stack trace.
+ *
+ * Traces are only captured when the library is built with `TERMINUS_OUTCOME_ENABLE_STACKTRACE`.
+ * Without it this policy compiles to nothing, so code that configures it does not need its own
+ * preprocessor checks.  With it, no error captures a trace until codes or a sampling rate are
+ * configured.  Sampling on its own applies to every code:
+ *
+ * @code
+ * using Policy = tmns::outcome::Stacktrace_Policy<tmns::core::error::Error_Code>;
+ * Policy::capture_codes( { Error_Code::DRIVER_FAILURE, Error_Code::GDAL_FAILURE } );
+ * Policy::sample_one_in( 16 );
+ * @endcode
+ *
+ * Selection applies to every error created at run time, including errors with only a code, so
+ * `fail( Error_Code::DRIVER_FAILURE )` captures a trace once `DRIVER_FAILURE` is selected.
+ * Errors the policy does not select never allocate for a trace.
+ *
+ * The settings are global and may be changed from any thread.  The sampling counter is per
+ * thread, so sampling never contends between threads.
+ *
+ * @tparam ErrorCodeT Error code enumeration the policy applies to.
+ */
+template <class ErrorCodeT>
+class Stacktrace_Policy
+{
+    public:
+
+        /// Largest code value that `capture_codes()` can select
+        static constexpr int cMaxFilteredCode = 63;
+
+        /**
+         * @brief Capture a trace for every code.  Turns on capture at a rate of one if no rate
+         *        was set.
+         */
+        static void capture_all() noexcept
+        {
+            s_state.codes.store( ~std::uint64_t{ 0 }, std::memory_order_relaxed );
+            s_state.others.store( true, std::memory_order_relaxed );
+            enable_sampling();
+        }
+
+        /**
+         * @brief Never capture a trace.
+         */
+        static void capture_none() noexcept
+        {
+            s_state.codes.store( 0, std::memory_order_relaxed );
+            s_state.others.store( false, std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Only capture a trace for the listed codes.  Codes outside of
+         *        [0, `cMaxFilteredCode`] are ignored.  Turns on capture at a rate of one if no
+         *        rate was set.
+         */
+        static void capture_codes( std::initializer_list<ErrorCodeT> codes ) noexcept
+        {
+            std::uint64_t mask = 0;
+            for( const auto code : codes )
+            {
+                const auto c = static_cast<int>( code );
+                if( c >= 0 && c <= cMaxFilteredCode )
+                {
+                    mask |= std::uint64_t{ 1 } << c;
+                }
+            }
+            s_state.codes.store( mask, std::memory_order_relaxed );
+            s_state.others.store( false, std::memory_order_relaxed );
+            enable_sampling();
+        }
+
+        /**
+         * @brief Capture a trace for one in every `n` selected errors on each thread.  A rate of
+         *        one captures every selected error, and zero captures none.
+         */
+        static void sample_one_in( std::uint32_t n ) noexcept
+        {
+            s_state.rate.store( n, std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Decide whether the error being constructed should capture a trace.
+         */
+        static bool should_capture( [[maybe_unused]] int c ) noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+            const bool selected = ( c >= 0 && c <= cMaxFilteredCode )
+                                ? ( ( s_state.codes.load( std::memory_order_relaxed ) >> c ) & 1u ) != 0
+                                : s_state.others.load( std::memory_order_relaxed );
+            if( !selected )
+            {
+                return false;
+            }
+            const auto rate = s_state.rate.load( std::memory_order_relaxed );
+            if( rate <= 1 )
+            {
+                return rate == 1;
+            }
+            thread_local std::uint32_t counter = 0;
+            return ( ++counter % rate ) == 0;
+#else
+            return false;
+#endif
+        }
+
+    private:
+
+        /**
+         * Shared settings for the code type.
+         */
+        struct State
+        {
+            /// One bit per selected code in [0, `cMaxFilteredCode`]
+            std::atomic<std::uint64_t> codes{ ~std::uint64_t{ 0 } };
+
+            /// Whether codes outside of the bit mask are selected
+            std::atomic<bool> others{ true };
+
+            /// Sampling rate, where zero captures nothing
+            std::atomic<std::uint32_t> rate{ 0 };
+        };
+
+        /**
+         * @brief Capture every selected error if sampling is still off.
+         */
+        static void enable_sampling() noexcept
+        {
+            std::uint32_t off = 0;
+            s_state.rate.compare_exchange_strong( off, 1, std::memory_order_relaxed );
+        }
+
+        /// Shared settings for the code type, constant-initialized so reads need no guard
+        static constinit inline State s_state{};
+
+}; // End of Stacktrace_Policy Class
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,321 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    format.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * `std::formatter` specializations for `Error`, `Result` and `Optional`, and the `fail( cFormat,
+ * code, fmt, args... )` form that checks its format string at compile time.  Everything here is
+ * only declared when the standard library provides `<format>`, in which case
+ * `TERMINUS_OUTCOME_HAS_FORMAT` is defined.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#if __has_include( <format> )
+    #include <format>
+#endif
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/error_domain.hpp>
+#include <terminus/outcome/optional.hpp>
+#include <terminus/outcome/panic.hpp>
+#include <terminus/outcome/result.hpp>
+
+/**
+ * libc++ 17 and 18 ship a usable `<format>` without defining `__cpp_lib_format`.
+ */
+#if defined( __cpp_lib_format ) || ( defined( _LIBCPP_VERSION ) && _LIBCPP_VERSION >= 170000 && __has_include( <format> ) )
+    #define TERMINUS_OUTCOME_HAS_FORMAT
+#endif
+
+#if defined( TERMINUS_OUTCOME_HAS_FORMAT )
+
+/**
+ * Capacity of the buffer `fail( cFormat, ... )` formats the details into.  Longer details are
+ * truncated and end with "...".
+ */
+#if !defined( TERMINUS_OUTCOME_FORMAT_CAPACITY )
+    #define TERMINUS_OUTCOME_FORMAT_CAPACITY 256
+#endif
+
+namespace tmns::outcome {
+
+/// Type tag used to request details formatted with `std::format` syntax.
+struct Format
+{
+    explicit constexpr Format() = default;
+};
+
+/// Value used to request details formatted with `std::format` syntax.
+inline constexpr Format cFormat{};
+
+namespace impl {
+
+/**
+ * What the `Error` formatter writes, chosen by the format spec.
+ */
+enum class Error_Format
+{
+    FULL, ///< `{}` or `{:f}`: the code's message, then ": " and the details if there are any
+    CODE, ///< `{:c}`: the category name and the numeric code, such as "Error 18"
+    NAME, ///< `{:n}`: the enumerator name for error domains, otherwise the code's message
+};
+
+/**
+ * @brief Report an invalid format spec.  At compile time, reaching this makes the format string
+ *        ill-formed.
+ */
+[[noreturn]] inline void throw_format_error( const char* what )
+{
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    raise_panic( std::format_error( what ) );
+#else
+    throw std::format_error( what );
+#endif
+}
+
+/**
+ * @brief Parse the `Error` format spec, which is empty or one of `f`, `c` and `n`.
+ */
+template <class ParseContextT>
+constexpr auto parse_error_format( ParseContextT& ctx, Error_Format& format )
+{
+    auto it = ctx.begin();
+    if( it == ctx.end() || *it == '}' )
+    {
+        return it;
+    }
+    switch( *it )
+    {
+        case 'f': format = Error_Format::FULL; break;
+        case 'c': format = Error_Format::CODE; break;
+        case 'n': format = Error_Format::NAME; break;
+        default:  throw_format_error( "invalid format spec for an Error, expected f, c or n" );
+    }
+    if( ++it != ctx.end() && *it != '}' )
+    {
+        throw_format_error( "invalid format spec for an Error, expected f, c or n" );
+    }
+    return it;
+}
+
+/**
+ * @brief Write `error` as selected by `format`.  The text goes to the output in one call per
+ *        error, so it is copied into the output buffer in bulk.
+ *
+ * Categories with a message table are written without building a string.  Other categories only
+ * offer `std::error_category::message()`, which returns one.
+ */
+template <class OutputIt, class ErrorCodeT>
+OutputIt write_error( OutputIt out, const Error<ErrorCodeT>& error, Error_Format format )
+{
+    if( format == Error_Format::CODE )
+    {
+        return std::format_to( std::move( out ), "{} {}", error.code().category().name(),
+                                                          static_cast<int>( error.code_enum() ) );
+    }
+    if constexpr ( Has_Name_Table<ErrorCodeT> )
+    {
+        if( format == Error_Format::NAME )
+        {
+            if( const auto name = error_code_name( error.code_enum() ); !name.empty() )
+            {
+                return std::format_to( std::move( out ), "{}", name );
+            }
+        }
+    }
+
+    std::conditional_t<Has_Message_View<ErrorCodeT>, std::string_view, std::string> message;
+    if constexpr ( Has_Message_View<ErrorCodeT> )
+    {
+        message = error.code_message();
+    }
+    else
+    {
+        message = error.code().message();
+    }
+    const auto details = error.details();
+    if( format == Error_Format::NAME || details.empty() )
+    {
+        return std::format_to( std::move( out ), "{}", message );
+    }
+    return std::format_to( std::move( out ), "{}: {}", message, details );
+}
+
+} // End of impl namespace
+
+/**
+ * Specialization of `fail` for details in `std::format` syntax: `fail( cFormat, code, fmt,
+ * args... )`.  The format string is checked against the arguments at compile time, and the
+ * details are formatted into a buffer of `TERMINUS_OUTCOME_FORMAT_CAPACITY` characters on the
+ * stack, so the only allocation is the error's payload.
+ *
+ * The tag is needed because `fail( code, args... )` already concatenates its arguments, so a
+ * format string could not be told apart from the first of them.
+ */
+template <class TagT, class ErrorCodeT, class FormatT, class... ArgsT>
+  requires std::same_as<std::remove_cvref_t<TagT>, Format>
+class fail<TagT, ErrorCodeT, FormatT, ArgsT...> : public impl::Failure_Type<Error<std::remove_cvref_t<ErrorCodeT>>>
+{
+    private:
+
+        using CODE_TYPE  = std::remove_cvref_t<ErrorCodeT>;
+        using ERROR_TYPE = Error<CODE_TYPE>;
+        using BASE_TYPE  = impl::Failure_Type<ERROR_TYPE>;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param code  The error code.
+         * @param fmt   Format string for the details, checked at compile time.
+         * @param args  The arguments to format.
+         * @param where Location of the call.  Leave this defaulted.
+         */
+        fail( TagT&&,
+              ErrorCodeT&&                 code,
+              std::format_string<ArgsT...> fmt,
+              ArgsT&&...                   args,
+              const std::source_location&  where = std::source_location::current() )
+          : BASE_TYPE{ make_error( where, code, fmt, std::forward<ArgsT>( args )... ) }
+        {}
+
+    private:
+
+        static ERROR_TYPE make_error( const std::source_location&  where,
+                                      CODE_TYPE                    code,
+                                      std::format_string<ArgsT...> fmt,
+                                      ArgsT&&...                   args )
+        {
+            char buffer[TERMINUS_OUTCOME_FORMAT_CAPACITY];
+            const auto result = std::format_to_n( buffer, static_cast<std::ptrdiff_t>( sizeof( buffer ) ), fmt,
+                                                  std::forward<ArgsT>( args )... );
+            const auto size = static_cast<std::size_t>( result.out - buffer );
+            if( static_cast<std::size_t>( result.size ) > size && size >= 3 )
+            {
+                std::fill_n( buffer + size - 3, 3, '.' );
+            }
+
+            ERROR_TYPE error{ where, code, std::string_view{ buffer, size } };
+            impl::notify_error_observer( error, where, Error_Event::Kind::FAIL );
+            return error;
+        }
+
+}; // End of fail Class
+
+} // End of tmns::outcome namespace
+
+/**
+ * Formatter for `Error`.  `{}` writes the same text as `operator<<`, `{:c}` the category and
+ * code, and `{:n}` the enumerator name.  The text is written straight to the output.
+ */
+template <class ErrorCodeT>
+struct std::formatter<tmns::outcome::Error<ErrorCodeT>, char>
+{
+    constexpr auto parse( std::format_parse_context& ctx )
+    {
+        return tmns::outcome::impl::parse_error_format( ctx, m_format );
+    }
+
+    template <class FormatContextT>
+    auto format( const tmns::outcome::Error<ErrorCodeT>& error, FormatContextT& ctx ) const
+    {
+        return tmns::outcome::impl::write_error( ctx.out(), error, m_format );
+    }
+
+    tmns::outcome::impl::Error_Format m_format{ tmns::outcome::impl::Error_Format::FULL };
+};
+
+/**
+ * Formatter for `Result`.  A value is written with its default format, `Result<void>` as "ok",
+ * and an error as "error: " followed by the error, to which the `Error` format spec applies.
+ */
+template <class ValueT, class ErrorCodeT>
+struct std::formatter<tmns::outcome::Result<ValueT,ErrorCodeT>, char>
+{
+    constexpr auto parse( std::format_parse_context& ctx )
+    {
+        return tmns::outcome::impl::parse_error_format( ctx, m_format );
+    }
+
+    template <class FormatContextT>
+    auto format( const tmns::outcome::Result<ValueT,ErrorCodeT>& result, FormatContextT& ctx ) const
+    {
+        if( result.has_error() )
+        {
+            auto out = std::format_to( ctx.out(), "error: " );
+            return tmns::outcome::impl::write_error( std::move( out ), result.assume_error(), m_format );
+        }
+        if constexpr ( std::is_void_v<ValueT> )
+        {
+            return std::format_to( ctx.out(), "ok" );
+        }
+        else
+        {
+            return std::format_to( ctx.out(), "{}", static_cast<const std::remove_reference_t<ValueT>&>( result.assume_value() ) );
+        }
+    }
+
+    tmns::outcome::impl::Error_Format m_format{ tmns::outcome::impl::Error_Format::FULL };
+};
+
+/**
+ * Since C++26 `std::optional` is a range, and so is an `Optional` derived from it.  Only
+ * `std::optional` itself is excluded from range formatting, so exclude `Optional` too, leaving
+ * the formatter below as the only one that applies.
+ */
+#if defined( __cpp_lib_format_ranges ) && defined( __cpp_lib_optional_range_support )
+namespace std {
+
+template <class ValueT>
+  requires ranges::input_range<tmns::outcome::Optional<ValueT>>
+constexpr range_format format_kind<tmns::outcome::Optional<ValueT>> = range_format::disabled;
+
+} // End of std namespace
+#endif
+
+/**
+ * Formatter for `Optional`.  The format spec is the value's; an empty optional is written as
+ * "empty".
+ */
+template <class ValueT>
+struct std::formatter<tmns::outcome::Optional<ValueT>, char>
+{
+    constexpr auto parse( std::format_parse_context& ctx )
+    {
+        return m_value.parse( ctx );
+    }
+
+    template <class FormatContextT>
+    auto format( const tmns::outcome::Optional<ValueT>& optional, FormatContextT& ctx ) const
+    {
+        if( !optional.has_value() )
+        {
+            return std::format_to( ctx.out(), "empty" );
+        }
+        return m_value.format( *optional, ctx );
+    }
+
+    std::formatter<std::remove_cvref_t<ValueT>, char> m_value;
+};
+
+#endif
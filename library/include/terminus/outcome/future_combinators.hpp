@@ -0,0 +1,244 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    future_combinators.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * `when_all()` and `when_any()` over `Result_Future`s.  Neither blocks: both attach to their
+ * inputs and return a future that completes as soon as the outcome is known.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/result.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+namespace tmns::outcome {
+
+namespace impl {
+
+/**
+ * Shared state of a `when_all()`, kept alive by the continuations attached to its inputs.
+ */
+template <class ValueT, class ErrorCodeT>
+class When_All_State
+{
+    public:
+
+        using OUTPUT_TYPE = std::conditional_t<std::is_void_v<ValueT>, void, std::vector<ValueT>>;
+
+        When_All_State( std::size_t count, std::stop_source stop )
+          : m_values( std::is_void_v<ValueT> ? 0 : count ),
+            m_remaining{ count },
+            m_stop{ std::move( stop ) }
+        {}
+
+        Result_Future<OUTPUT_TYPE,ErrorCodeT> get_future()
+        {
+            return m_promise.get_future();
+        }
+
+        /**
+         * @brief Record the result of input `index`.
+         */
+        void complete( std::size_t index, Result<ValueT,ErrorCodeT>&& result )
+        {
+            if( result.has_error() )
+            {
+                if( !m_done.exchange( true, std::memory_order_acq_rel ) )
+                {
+                    m_stop.request_stop();
+                    m_promise.set_error( std::move( result ).assume_error() );
+                }
+                return;
+            }
+            if constexpr ( !std::is_void_v<ValueT> )
+            {
+                m_values[index].emplace( std::move( result ).assume_value() );
+            }
+            if( m_remaining.fetch_sub( 1, std::memory_order_acq_rel ) == 1 &&
+                !m_done.exchange( true, std::memory_order_acq_rel ) )
+            {
+                finish();
+            }
+        }
+
+        /**
+         * @brief Complete the output once every input has succeeded.
+         */
+        void finish()
+        {
+            if constexpr ( std::is_void_v<ValueT> )
+            {
+                m_promise.set_value();
+            }
+            else
+            {
+                std::vector<ValueT> values;
+                values.reserve( m_values.size() );
+                for( auto& value : m_values )
+                {
+                    values.push_back( std::move( *value ) );
+                }
+                m_promise.set_value( std::move( values ) );
+            }
+        }
+
+    private:
+
+        /// Slot type for the values, unused for `void`
+        using SLOT_TYPE = std::optional<std::conditional_t<std::is_void_v<ValueT>, bool, ValueT>>;
+
+        /// Receives the combined result
+        Result_Promise<OUTPUT_TYPE,ErrorCodeT> m_promise;
+
+        /// Values of the inputs that have succeeded, by index
+        std::vector<SLOT_TYPE> m_values;
+
+        /// Inputs that have not succeeded yet
+        std::atomic<std::size_t> m_remaining;
+
+        /// Set once the output has been completed
+        std::atomic<bool> m_done{ false };
+
+        /// Stops the remaining work on the first error
+        std::stop_source m_stop;
+
+}; // End of When_All_State Class
+
+/**
+ * Shared state of a `when_any()`, kept alive by the continuations attached to its inputs.
+ */
+template <class ValueT, class ErrorCodeT>
+class When_Any_State
+{
+    public:
+
+        When_Any_State( std::size_t count, std::stop_source stop )
+          : m_remaining{ count },
+            m_stop{ std::move( stop ) }
+        {}
+
+        Result_Future<ValueT,ErrorCodeT> get_future()
+        {
+            return m_promise.get_future();
+        }
+
+        /**
+         * @brief Record the result of one input.  The first success wins; if every input fails,
+         *        the last error is passed on.
+         */
+        void complete( Result<ValueT,ErrorCodeT>&& result )
+        {
+            const bool last = m_remaining.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+            if( ( result.has_value() || last ) && !m_done.exchange( true, std::memory_order_acq_rel ) )
+            {
+                m_stop.request_stop();
+                m_promise.set_result( std::move( result ) );
+            }
+        }
+
+    private:
+
+        /// Receives the first success
+        Result_Promise<ValueT,ErrorCodeT> m_promise;
+
+        /// Inputs that have not completed yet
+        std::atomic<std::size_t> m_remaining;
+
+        /// Set once the output has been completed
+        std::atomic<bool> m_done{ false };
+
+        /// Stops the remaining work once the outcome is known
+        std::stop_source m_stop;
+
+}; // End of When_Any_State Class
+
+} // End of impl namespace
+
+/**
+ * @brief Combine futures into one holding all of their values, in order.
+ *
+ * The returned future completes with the values once every input has succeeded, or with the
+ * first error as soon as it arrives.  The error also requests `stop`, so jobs submitted to a
+ * `Thread_Pool` with its token and not yet started are skipped.  The other inputs are left to
+ * finish and their results are dropped.
+ *
+ * @param futures Futures to combine.  They are consumed.
+ * @param stop    Stop source for the remaining work.
+ *
+ * @returns A future of `std::vector<ValueT>`, or of `void` for `Result_Future<void,...>` inputs.
+ */
+template <class ValueT, class ErrorCodeT>
+auto when_all( std::vector<Result_Future<ValueT,ErrorCodeT>> futures,
+               std::stop_source                              stop = std::stop_source{ std::nostopstate } )
+{
+    static_assert( !std::is_reference_v<ValueT>, "when_all() cannot collect references" );
+
+    auto state  = std::make_shared<impl::When_All_State<ValueT,ErrorCodeT>>( futures.size(), std::move( stop ) );
+    auto future = state->get_future();
+    if( futures.empty() )
+    {
+        state->finish();
+        return future;
+    }
+    for( std::size_t i = 0; i < futures.size(); ++i )
+    {
+        assert( futures[i].valid() );
+        impl::Future_Access::attach( std::move( futures[i] ),
+                                     [state, i]( Result<ValueT,ErrorCodeT>&& r )
+                                     {
+                                         state->complete( i, std::move( r ) );
+                                     } );
+    }
+    return future;
+}
+
+/**
+ * @brief Combine futures into one holding the first success.
+ *
+ * The returned future completes with the first input to succeed, and then requests `stop` to
+ * skip work that has not started.  If every input fails it completes with the last error, and if
+ * there are no inputs, with the code returned by `outcome_broken_promise_code()`.
+ *
+ * @param futures Futures to combine.  They are consumed.
+ * @param stop    Stop source for the remaining work.
+ */
+template <class ValueT, class ErrorCodeT>
+Result_Future<ValueT,ErrorCodeT> when_any( std::vector<Result_Future<ValueT,ErrorCodeT>> futures,
+                                           std::stop_source                              stop = std::stop_source{ std::nostopstate } )
+{
+    auto state  = std::make_shared<impl::When_Any_State<ValueT,ErrorCodeT>>( futures.size(), std::move( stop ) );
+    auto future = state->get_future();
+    for( auto& f : futures )
+    {
+        assert( f.valid() );
+        impl::Future_Access::attach( std::move( f ),
+                                     [state]( Result<ValueT,ErrorCodeT>&& r )
+                                     {
+                                         state->complete( std::move( r ) );
+                                     } );
+    }
+    return future;
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,74 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    fwd.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Forward declarations of the library's class templates.  Headers that only name `Result`,
+ * `Error` or `Optional` in declarations can include this instead of `terminus/outcome.hpp`, and
+ * leave the full include to the translation units that construct or inspect them.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <system_error>
+
+namespace tmns::outcome {
+
+template <class ErrorCodeT>
+  requires std::is_error_code_enum_v<ErrorCodeT>
+class Error;
+
+template <class ValueT, class ErrorCodeT>
+class Result;
+
+template <class ValueT>
+class Optional;
+
+template <class ValueT>
+struct Optional_Niche;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Promise;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Future;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Slot;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Batch;
+
+template <class ResultT>
+class Task;
+
+template <class DerivedErrorCategoryT>
+class Error_Category;
+
+template <class ErrorCodeT>
+class Multi_Error;
+
+template <class ErrorCodeT>
+class Multi_Error_Collector;
+
+template <class ValueT>
+struct Wire_Codec;
+
+template <class ValueT>
+class Wire_Result_View;
+
+class Error_Arena;
+class Thread_Pool;
+class Scoped_Error_Arena;
+class Wire_Reader;
+
+} // End of tmns::outcome namespace
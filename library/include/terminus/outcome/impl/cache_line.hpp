@@ -0,0 +1,45 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    cache_line.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Cache line size used to keep per-thread state from sharing lines.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <new>
+
+namespace tmns::outcome::impl {
+
+/**
+ * @brief Alignment that keeps objects written by different threads off each other's cache lines.
+ *
+ * Uses `std::hardware_destructive_interference_size` when the library provides it, and 64
+ * bytes otherwise.  GCC warns because the value follows `-mtune`; it only pads internal
+ * members, so every translation unit of a program must simply be built with the same tuning.
+ */
+#if defined( __cpp_lib_hardware_interference_size )
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t cCache_Line_Size = std::hardware_destructive_interference_size;
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t cCache_Line_Size = 64;
+#endif
+
+} // End of tmns::outcome::impl namespace
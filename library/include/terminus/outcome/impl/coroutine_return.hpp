@@ -0,0 +1,32 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    coroutine_return.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Tag shared by the `Result` backends and `terminus/outcome/coroutine.hpp`.
+*/
+#pragma once
+
+namespace tmns::outcome::impl {
+
+/**
+ * Constructs a placeholder `Result` for a coroutine whose compiler converts the return object
+ * before the body runs.  The constructor records its own address in `target`, and the coroutine
+ * assigns the real result there when it finishes.
+ */
+struct Coroutine_Return_Tag
+{
+    /// Where the constructed `Result` records its address
+    void** target;
+};
+
+} // End of tmns::outcome::impl namespace
@@ -0,0 +1,301 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_counters.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Counters behind `count_error()`, kept apart from the snapshot and the Prometheus writers in
+ * `terminus/outcome/error_counters.hpp` so that `error.hpp` only pulls in what counting needs.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/error_category.hpp>
+#include <terminus/outcome/error_domain.hpp>
+#include <terminus/outcome/impl/cache_line.hpp>
+
+/**
+ * Number of codes counted individually for error code enumerations that were not generated by
+ * `TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN`.  Codes outside `[0, N)` share one overflow counter.
+ */
+#if !defined( TERMINUS_OUTCOME_ERROR_COUNTER_CODES )
+    #define TERMINUS_OUTCOME_ERROR_COUNTER_CODES 64
+#endif
+
+namespace tmns::outcome {
+
+/**
+ * Number of errors created with one code, as reported by `error_counts()`.
+ */
+struct Error_Count
+{
+    /// Name of the error category
+    std::string_view category;
+
+    /// Code value, or -1 for the codes counted together in the overflow counter
+    int code;
+
+    /// Enumerator name for error domains, otherwise the category's message
+    std::string name;
+
+    /// Number of errors created with the code
+    std::uint64_t count;
+};
+
+namespace impl {
+
+/**
+ * Counters of one error code enumeration, as seen by the registry.  The tables link themselves
+ * into a list when first used, and are never destroyed.
+ */
+class Error_Counter_Table
+{
+    public:
+
+        /**
+         * @brief Append the non-zero counters to `out`.
+         */
+        virtual void snapshot( std::vector<Error_Count>& out ) const = 0;
+
+        /**
+         * @brief First table in the registry.
+         */
+        static const Error_Counter_Table* first() noexcept
+        {
+            return s_head.load( std::memory_order_acquire );
+        }
+
+        /**
+         * @brief Next table in the registry.
+         */
+        const Error_Counter_Table* next() const noexcept
+        {
+            return m_next;
+        }
+
+    protected:
+
+        Error_Counter_Table() noexcept
+          : m_next{ s_head.load( std::memory_order_relaxed ) }
+        {
+            while( !s_head.compare_exchange_weak( m_next, this, std::memory_order_release, std::memory_order_relaxed ) ) {}
+        }
+
+        ~Error_Counter_Table() = default;
+
+    private:
+
+        /// Most recently registered table
+        static inline std::atomic<const Error_Counter_Table*> s_head{ nullptr };
+
+        /// Table registered before this one
+        const Error_Counter_Table* m_next;
+
+}; // End of Error_Counter_Table Class
+
+/**
+ * Counters of the codes of `ErrorCodeT`.
+ *
+ * Each thread that counts an error gets its own row of counters, on its own cache lines, and
+ * is the only writer of it, so an increment is a relaxed load and store with no locked
+ * instruction.  Rows are kept in a lock-free list and never freed: a thread that exits releases
+ * its row, and the next new thread takes it over and keeps adding to it, so no count is lost
+ * and the number of rows is bounded by the peak number of threads.
+ */
+template <class ErrorCodeT>
+class Error_Counters final : public Error_Counter_Table
+{
+    public:
+
+        /// Codes counted individually; the slot after them is the overflow counter
+        static constexpr std::size_t cCodes = [] {
+            if constexpr ( Has_Name_Table<ErrorCodeT> )
+            {
+                return Category_Of<ErrorCodeT>::cNames.size();
+            }
+            else
+            {
+                return std::size_t{ TERMINUS_OUTCOME_ERROR_COUNTER_CODES };
+            }
+        }();
+
+        /**
+         * @brief The counters of `ErrorCodeT`, registered on first use.
+         */
+        static Error_Counters& instance()
+        {
+            static Error_Counters* counters = new Error_Counters;
+            return *counters;
+        }
+
+        /**
+         * @brief Count one error with code `c` on the calling thread's row.
+         */
+        static void increment( int c ) noexcept
+        {
+            const auto slot = c >= 0 && static_cast<std::size_t>( c ) < cCodes ? static_cast<std::size_t>( c ) : cCodes;
+            auto row = t_row;
+            if( row == nullptr ) [[unlikely]]
+            {
+                row = attach();
+                if( row == nullptr )
+                {
+                    instance().m_shared.counts[slot].fetch_add( 1, std::memory_order_relaxed );
+                    return;
+                }
+            }
+            auto& counter = row->counts[slot];
+            counter.store( counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        }
+
+        void snapshot( std::vector<Error_Count>& out ) const override
+        {
+            const auto& category = std::error_code( static_cast<ErrorCodeT>( 0 ) ).category();
+            for( std::size_t slot = 0; slot <= cCodes; ++slot )
+            {
+                std::uint64_t total = m_shared.counts[slot].load( std::memory_order_relaxed );
+                for( auto row = m_rows.load( std::memory_order_acquire ); row != nullptr; row = row->next )
+                {
+                    total += row->counts[slot].load( std::memory_order_relaxed );
+                }
+                if( total == 0 )
+                {
+                    continue;
+                }
+                if( slot == cCodes )
+                {
+                    out.push_back( Error_Count{ category.name(), -1, "other", total } );
+                    continue;
+                }
+                const auto c = static_cast<int>( slot );
+                std::string name;
+                if constexpr ( Has_Name_Table<ErrorCodeT> )
+                {
+                    name = error_code_name( static_cast<ErrorCodeT>( c ) );
+                }
+                else
+                {
+                    name = category.message( c );
+                }
+                out.push_back( Error_Count{ category.name(), c, std::move( name ), total } );
+            }
+        }
+
+    private:
+
+        /**
+         * Counters written by one thread at a time.
+         */
+        struct alignas( cCache_Line_Size ) Row
+        {
+            std::array<std::atomic<std::uint64_t>,cCodes + 1> counts{};
+            std::atomic<bool> in_use{ true };
+            Row* next{ nullptr };
+        };
+
+        /**
+         * Releases the calling thread's row when the thread exits.
+         */
+        struct Row_Release
+        {
+            Row* row;
+
+            ~Row_Release()
+            {
+                t_row    = nullptr;
+                t_exited = true;
+                row->in_use.store( false, std::memory_order_release );
+            }
+        };
+
+        Error_Counters() = default;
+
+        /**
+         * @brief Give the calling thread a row, reusing one released by an exited thread if
+         *        possible.
+         *
+         * @returns Null if the thread is exiting or a row cannot be allocated, in which case the
+         *          error is counted on the shared row with an atomic increment.
+         */
+        static Row* attach() noexcept
+        {
+            if( t_exited )
+            {
+                return nullptr;
+            }
+            auto& table = instance();
+            Row* row = nullptr;
+            for( auto r = table.m_rows.load( std::memory_order_acquire ); r != nullptr && row == nullptr; r = r->next )
+            {
+                bool expected = false;
+                if( r->in_use.compare_exchange_strong( expected, true, std::memory_order_acquire, std::memory_order_relaxed ) )
+                {
+                    row = r;
+                }
+            }
+            if( row == nullptr )
+            {
+                row = new ( std::nothrow ) Row;
+                if( row == nullptr )
+                {
+                    return nullptr;
+                }
+                row->next = table.m_rows.load( std::memory_order_relaxed );
+                while( !table.m_rows.compare_exchange_weak( row->next, row, std::memory_order_release, std::memory_order_relaxed ) ) {}
+            }
+            t_row = row;
+            thread_local Row_Release release{ row };
+            return row;
+        }
+
+        /// Row of the calling thread, or null before its first error and once it exits
+        static constinit inline thread_local Row* t_row = nullptr;
+
+        /// Set once the calling thread has released its row
+        static constinit inline thread_local bool t_exited = false;
+
+        /// Rows of the threads, newest first
+        std::atomic<Row*> m_rows{ nullptr };
+
+        /// Row shared, with atomic increments, by threads that have no row of their own
+        Row m_shared{};
+
+}; // End of Error_Counters Class
+
+} // End of impl namespace
+
+/**
+ * @brief Count one error with code `ec`.
+ *
+ * `Error` calls this from its constructors when `TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS` is
+ * defined.  Code that reports failures without building an `Error` can call it directly.  Costs
+ * a thread-local load and an unlocked increment of a counter only the calling thread writes.
+ */
+template <class ErrorCodeT>
+  requires std::is_error_code_enum_v<ErrorCodeT>
+void count_error( ErrorCodeT ec ) noexcept
+{
+    impl::Error_Counters<ErrorCodeT>::increment( static_cast<int>( ec ) );
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,122 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_observer.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Observer hook called by `fail()` and `panic()`, kept apart from `Error_Ring_Buffer` in
+ * `terminus/outcome/error_observer.hpp` so that `result.hpp` only pulls in what reporting needs.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <system_error>
+
+// Terminus Libraries
+#include <terminus/outcome/panic.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Error reported to an `Error_Observer`.  The views are only valid during the call.
+ */
+struct Error_Event
+{
+    /// What created the error
+    enum class Kind : std::uint8_t
+    {
+        FAIL,
+        PANIC
+    };
+
+    /// Code of the error
+    std::error_code code;
+
+    /// Details of the error.  Empty when `details_deferred` is set.
+    std::string_view details;
+
+    /// Location of the `fail()` or `panic()` call
+    std::source_location where;
+
+    /// What created the error
+    Kind kind;
+
+    /// True if the error has deferred details that were not formatted, which reporting never does
+    bool details_deferred{ false };
+};
+
+/**
+ * Receives the errors created by `fail()` and `panic()` while it is installed with
+ * `set_error_observer()` and `TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER` is defined.
+ *
+ * `on_error()` runs on the thread creating the error, so it should be quick and must not throw.
+ */
+class Error_Observer
+{
+    public:
+
+        virtual void on_error( const Error_Event& event ) noexcept = 0;
+
+    protected:
+
+        ~Error_Observer() = default;
+
+}; // End of Error_Observer Class
+
+namespace impl {
+
+/**
+ * @brief The installed observer.
+ */
+inline std::atomic<Error_Observer*>& error_observer() noexcept
+{
+    static constinit std::atomic<Error_Observer*> observer{ nullptr };
+    return observer;
+}
+
+/**
+ * @brief Report a new error to the installed observer.  Compiles to nothing unless
+ *        `TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER` is defined.
+ */
+template <class ErrorT>
+void notify_error_observer( [[maybe_unused]] const ErrorT&               error,
+                            [[maybe_unused]] const std::source_location& where,
+                            [[maybe_unused]] Error_Event::Kind           kind ) noexcept
+{
+#if defined( TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER )
+    if( auto observer = error_observer().load( std::memory_order_acquire ) ) [[unlikely]]
+    {
+        const auto details = error.rendered_details();
+        observer->on_error( Error_Event{ error.code(), details.value_or( std::string_view{} ), where, kind, !details } );
+    }
+#endif
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Install `observer`, or remove the current one with null.
+ *
+ * The observer must stay alive until it has been removed and every `fail()` that may have seen it
+ * has returned, so it is usually a static object.
+ *
+ * @returns The previous observer.
+ */
+inline Error_Observer* set_error_observer( Error_Observer* observer ) noexcept
+{
+    return impl::error_observer().exchange( observer, std::memory_order_acq_rel );
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,477 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_payload.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::outcome::impl {
+
+/// String stream whose buffer is allocated from a memory resource
+using Pmr_Ostringstream = std::basic_ostringstream<char,
+                                                   std::char_traits<char>,
+                                                   std::pmr::polymorphic_allocator<char>>;
+
+/**
+ * @brief Resource for details rendered after a payload was created.  Rendering happens on
+ *        whichever thread first asks for them, while the payload's own resource may be an
+ *        `Error_Arena` that only its owning thread may allocate from.
+ */
+inline std::pmr::memory_resource* rendering_resource() noexcept
+{
+    return std::pmr::new_delete_resource();
+}
+
+/**
+ * Immutable, reference-counted block holding everything an `Error` carries besides its code.
+ *
+ * An `Error` only allocates one of these when it has details.  Copying the error while it
+ * propagates back up the call stack is then just a reference count increment.  The block
+ * stores the error code as well, so the owning `Error` can be a single pointer wide.
+ *
+ * Blocks are allocated from a `std::pmr::memory_resource` and remember it, so they can be
+ * returned to the right place no matter which thread drops the last reference.  Nothing else is
+ * allocated from that resource after construction; details rendered later come from
+ * `rendering_resource()`, so reading an error on another thread does not touch the creator's
+ * resource.
+ */
+class Error_Payload
+{
+    public:
+
+        /**
+         * @brief Get the integer error code.
+         */
+        int code() const noexcept
+        {
+            return m_code;
+        }
+
+        /**
+         * @brief Get the memory resource the block was allocated from.
+         */
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            return m_resource;
+        }
+
+        /**
+         * @brief Get the detailed message, including any context frames.
+         */
+        virtual std::string_view details() const = 0;
+
+        /**
+         * @brief Get the detailed message if it is available without formatting anything, or
+         *        nothing while deferred details have not been rendered yet.
+         */
+        virtual std::optional<std::string_view> rendered_details() const noexcept
+        {
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Get the text this block contributes on its own, without older frames.
+         */
+        virtual std::string_view frame() const
+        {
+            return details();
+        }
+
+        /**
+         * @brief Get the next older frame, or null if this is the first one.
+         */
+        virtual const Error_Payload* next() const noexcept
+        {
+            return nullptr;
+        }
+
+        /**
+         * @brief True if this block is a context frame added with `Error::append()`.
+         */
+        virtual bool is_context() const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Add a reference to the block.
+         */
+        void retain() const noexcept
+        {
+            m_refs.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Drop a reference to the block, destroying it when it was the last one.
+         *
+         * A destroyed block hands its reference to the next older frame back to this loop
+         * instead of releasing it from its destructor, so freeing a long context chain runs in
+         * constant stack.
+         */
+        void release() const noexcept
+        {
+            const Error_Payload* p = this;
+            while( p != nullptr && p->m_refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            {
+                const Error_Payload* next = p->detach_next();
+                p->destroy();
+                p = next;
+            }
+        }
+
+    protected:
+
+        /**
+         * @brief Constructor.  The block starts with a single reference.
+         */
+        Error_Payload( std::pmr::memory_resource* resource, int code ) noexcept
+          : m_resource{ resource },
+            m_code{ code }
+        {}
+
+        /**
+         * @brief Only destroyed through `release()`.
+         */
+        virtual ~Error_Payload() = default;
+
+        /**
+         * @brief Destroy the block and return its memory to the resource.
+         */
+        virtual void destroy() const noexcept = 0;
+
+        /**
+         * @brief Take over this block's reference to the next older frame, if it holds one.
+         *        Only called on a block about to be destroyed.
+         */
+        virtual const Error_Payload* detach_next() const noexcept
+        {
+            return nullptr;
+        }
+
+        /**
+         * @brief Helper for `destroy()` implementations.
+         */
+        template <class PayloadT>
+        static void destroy_as( const PayloadT* p ) noexcept
+        {
+            std::pmr::polymorphic_allocator<> alloc{ p->resource() };
+            alloc.delete_object( const_cast<PayloadT*>( p ) );
+        }
+
+    private:
+
+        /// Resource the block was allocated from
+        std::pmr::memory_resource* m_resource;
+
+        /// Number of errors sharing this block
+        mutable std::atomic<std::uint32_t> m_refs{ 1 };
+
+        /// Integer representation of the error code
+        int m_code;
+
+}; // End of Error_Payload Class
+
+/**
+ * Payload whose details were formatted when the error was constructed.
+ */
+class Details_Payload final : public Error_Payload
+{
+    public:
+
+        Details_Payload( std::pmr::memory_resource* resource, int code, std::pmr::string&& details ) noexcept
+          : Error_Payload{ resource, code },
+            m_details{ std::move( details ) }
+        {}
+
+        Details_Payload( std::pmr::memory_resource* resource, int code, std::string_view details )
+          : Error_Payload{ resource, code },
+            m_details{ details, resource }
+        {}
+
+        std::string_view details() const override
+        {
+            return m_details;
+        }
+
+        std::optional<std::string_view> rendered_details() const noexcept override
+        {
+            return std::string_view{ m_details };
+        }
+
+    protected:
+
+        void destroy() const noexcept override
+        {
+            destroy_as( this );
+        }
+
+    private:
+
+        /// Message with additional details
+        std::pmr::string m_details;
+
+}; // End of Details_Payload Class
+
+/**
+ * @brief True for `std::span`, which a deferred error could only keep as a view.
+ */
+template <class T>
+inline constexpr bool cIs_Span = false;
+
+template <class T, std::size_t ExtentV>
+inline constexpr bool cIs_Span<std::span<T,ExtentV>> = true;
+
+/**
+ * @brief Type a deferred argument is stored as.  Anything that converts to `std::string_view`,
+ *        including C-strings, is copied into a `std::pmr::string`.
+ */
+template <class ArgT>
+using Deferred_Arg = std::conditional_t<std::is_convertible_v<const ArgT&, std::string_view>,
+                                        std::pmr::string,
+                                        ArgT>;
+
+/**
+ * @brief Copy one argument of a deferred error into the form the payload stores.
+ */
+template <class ArgT, class UArgT>
+Deferred_Arg<ArgT> make_deferred_arg( std::pmr::memory_resource* resource, UArgT&& arg )
+{
+    static_assert( !cIs_Span<ArgT>,
+                   "A span passed to a deferred error would dangle; pass an owning container instead" );
+    if constexpr ( std::is_same_v<Deferred_Arg<ArgT>, std::pmr::string> )
+    {
+        if constexpr ( std::is_pointer_v<std::remove_cvref_t<UArgT>> )
+        {
+            if( arg == nullptr )
+            {
+                return std::pmr::string{ resource };
+            }
+        }
+        return std::pmr::string{ std::string_view{ arg }, resource };
+    }
+    else
+    {
+        return std::forward<UArgT>( arg );
+    }
+}
+
+/**
+ * Payload holding a decayed copy of the arguments of an `Error` created with deferred details.
+ * Strings and string views are copied into the payload's memory resource, so no argument refers
+ * to the caller's storage.
+ *
+ * The arguments are only written to a stream the first time the details are requested.  The
+ * rendered string is then cached so later calls (and every error sharing this block) do not pay
+ * the formatting cost again.
+ */
+template <class... ArgsT>
+class Deferred_Payload final : public Error_Payload
+{
+    public:
+
+        template <class... UArgsT>
+        Deferred_Payload( std::pmr::memory_resource* resource, int code, UArgsT&&... args )
+          : Error_Payload{ resource, code },
+            m_args{ make_deferred_arg<ArgsT>( resource, std::forward<UArgsT>( args ) )... },
+            m_details{ rendering_resource() }
+        {}
+
+        std::string_view details() const override
+        {
+            std::call_once( m_once, [this](){
+                Pmr_Ostringstream sout{ std::ios_base::out, rendering_resource() };
+                std::apply( [&sout]( const auto&... args ){ ( sout << ... << args ); }, m_args );
+                m_details = std::move( sout ).str();
+                m_rendered.store( true, std::memory_order_release );
+            });
+            return m_details;
+        }
+
+        std::optional<std::string_view> rendered_details() const noexcept override
+        {
+            if( !m_rendered.load( std::memory_order_acquire ) )
+            {
+                return std::nullopt;
+            }
+            return std::string_view{ m_details };
+        }
+
+    protected:
+
+        void destroy() const noexcept override
+        {
+            destroy_as( this );
+        }
+
+    private:
+
+        /// Copies of the arguments passed to the error constructor
+        std::tuple<Deferred_Arg<ArgsT>...> m_args;
+
+        /// Guards the one-time rendering of the details
+        mutable std::once_flag m_once;
+
+        /// Rendered details, allocated from `rendering_resource()`
+        mutable std::pmr::string m_details;
+
+        /// Set once `m_details` holds the rendered details
+        mutable std::atomic<bool> m_rendered{ false };
+
+}; // End of Deferred_Payload Class
+
+/**
+ * Context frame added to an error as it propagates.
+ *
+ * Frames form an immutable, singly-linked list from the newest frame to the original details.
+ * Each frame owns a reference to the next older one, so appending is O(1) and copies made
+ * before the append are left untouched.  The flattened details are only built when first
+ * requested, with a single allocation, and then cached on the frame.
+ */
+class Context_Payload final : public Error_Payload
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param next Next older frame, or null if the error had no payload.  The new frame
+         *             takes over the caller's reference.
+         * @param text Context added by this frame.
+         */
+        Context_Payload( std::pmr::memory_resource* resource, int code, const Error_Payload* next, std::string_view text )
+          : Error_Payload{ resource, code },
+            m_next{ next },
+            m_text{ text, resource },
+            m_details{ rendering_resource() }
+        {}
+
+        std::string_view details() const override
+        {
+            std::call_once( m_once, [this](){
+                m_details = flatten();
+                m_flattened.store( true, std::memory_order_release );
+            });
+            return m_details;
+        }
+
+        std::optional<std::string_view> rendered_details() const noexcept override
+        {
+            if( !m_flattened.load( std::memory_order_acquire ) )
+            {
+                return std::nullopt;
+            }
+            return std::string_view{ m_details };
+        }
+
+        std::string_view frame() const override
+        {
+            return m_text;
+        }
+
+        const Error_Payload* next() const noexcept override
+        {
+            return m_next;
+        }
+
+        bool is_context() const noexcept override
+        {
+            return true;
+        }
+
+    protected:
+
+        void destroy() const noexcept override
+        {
+            destroy_as( this );
+        }
+
+        const Error_Payload* detach_next() const noexcept override
+        {
+            return std::exchange( m_next, nullptr );
+        }
+
+    private:
+
+        /**
+         * @brief Render the frames oldest first, separated by ": ".  The string is sized up
+         *        front and filled from the back, since the list runs newest first.
+         */
+        std::pmr::string flatten() const
+        {
+            static constexpr std::string_view cSeparator{ ": " };
+
+            std::size_t size = 0;
+            const Error_Payload* p = this;
+            for( ; p != nullptr && p->is_context(); p = p->next() )
+            {
+                size += cSeparator.size() + p->frame().size();
+            }
+            const std::string_view root = ( p != nullptr ) ? p->details() : std::string_view{};
+            size += root.size();
+
+            std::pmr::string out( size, '\0', rendering_resource() );
+            auto pos = size;
+            for( p = this; p != nullptr && p->is_context(); p = p->next() )
+            {
+                const auto text = p->frame();
+                pos -= text.size();
+                text.copy( out.data() + pos, text.size() );
+                pos -= cSeparator.size();
+                cSeparator.copy( out.data() + pos, cSeparator.size() );
+            }
+            root.copy( out.data(), root.size() );
+            return out;
+        }
+
+        /// Next older frame, detached by `release()` before the frame is destroyed
+        mutable const Error_Payload* m_next;
+
+        /// Context added by this frame
+        std::pmr::string m_text;
+
+        /// Guards the one-time flattening of the details
+        mutable std::once_flag m_once;
+
+        /// Flattened details, allocated from `rendering_resource()`
+        mutable std::pmr::string m_details;
+
+        /// Set once `m_details` holds the flattened details
+        mutable std::atomic<bool> m_flattened{ false };
+
+}; // End of Context_Payload Class
+
+/**
+ * @brief Allocate a payload from the memory resource.
+ */
+template <class PayloadT, class... ArgsT>
+const PayloadT* make_payload( std::pmr::memory_resource* resource, ArgsT&&... args )
+{
+    std::pmr::polymorphic_allocator<> alloc{ resource };
+    return alloc.new_object<PayloadT>( resource, std::forward<ArgsT>( args )... );
+}
+
+} // End of tmns::outcome::impl namespace
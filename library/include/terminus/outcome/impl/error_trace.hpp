@@ -0,0 +1,171 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    error_trace.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <source_location>
+#include <span>
+
+// Terminus Libraries
+#include <terminus/outcome/error_stacktrace.hpp>
+
+/**
+ * Maximum number of propagation sites an `Error` records when
+ * `TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES` is defined.  Sites past the limit are counted
+ * but not stored.
+ */
+#if !defined( TERMINUS_OUTCOME_PROPAGATION_SITES )
+    #define TERMINUS_OUTCOME_PROPAGATION_SITES 8
+#endif
+
+namespace tmns::outcome::impl {
+
+/**
+ * Where an error came from, stored inline in every `Error`.
+ *
+ * - The origin is the `std::source_location` captured by `fail()`.  It is a pointer to a
+ *   compiler-generated constant on GCC and Clang, so capturing it neither formats nor allocates,
+ *   but storing it makes `Error` two pointers wide.  It is only stored when
+ *   `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined.
+ *
+ * - Propagation sites are the `TERMINUS_OUTCOME_TRY` expansions the error passed through, oldest
+ *   first.  They cost `TERMINUS_OUTCOME_PROPAGATION_SITES` locations per error, so they are only
+ *   recorded when `TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES` is defined.
+ *
+ * - The stack trace is only captured when `TERMINUS_OUTCOME_ENABLE_STACKTRACE` is defined and
+ *   the error's `Stacktrace_Policy` selects it.  It is shared between copies of the error.
+ *
+ * When all of them are disabled this type is empty and takes no space in `Error`.  Each one changes
+ * the layout of `Error`, so they are set by the build options of the library target, which define
+ * them for every consumer, rather than per translation unit.
+ */
+class Error_Trace
+{
+    public:
+
+        /**
+         * @brief Get the location the error was created, or a default location if unknown.
+         */
+        constexpr std::source_location origin() const noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION )
+            return m_origin;
+#else
+            return {};
+#endif
+        }
+
+        /**
+         * @brief Set the location the error was created.
+         */
+        constexpr void set_origin( [[maybe_unused]] const std::source_location& where ) noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION )
+            m_origin = where;
+#endif
+        }
+
+        /**
+         * @brief Get the recorded propagation sites, oldest first.
+         */
+        constexpr std::span<const std::source_location> sites() const noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+            return { m_sites.data(), m_site_count < m_sites.size() ? m_site_count : m_sites.size() };
+#else
+            return {};
+#endif
+        }
+
+        /**
+         * @brief Get the number of sites the error propagated through, including any that
+         *        were not stored.
+         */
+        constexpr std::size_t site_count() const noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+            return m_site_count;
+#else
+            return 0;
+#endif
+        }
+
+        /**
+         * @brief Record a propagation site.
+         */
+        constexpr void add_site( [[maybe_unused]] const std::source_location& where ) noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+            if( m_site_count < m_sites.size() )
+            {
+                m_sites[m_site_count] = where;
+            }
+            ++m_site_count;
+#endif
+        }
+
+        /**
+         * @brief Get the captured stack trace, or null if there is none.
+         */
+        const Error_Stacktrace* stacktrace() const noexcept
+        {
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+            return m_stacktrace.get();
+#else
+            return nullptr;
+#endif
+        }
+
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+        /**
+         * @brief Capture the current stack, allocating it from the memory resource.
+         *
+         * @param skip Number of innermost frames to leave out, not counting this function.
+         */
+        void capture_stacktrace( std::pmr::memory_resource* resource, std::size_t skip )
+        {
+            m_stacktrace = std::allocate_shared<const Error_Stacktrace>( std::pmr::polymorphic_allocator<>{ resource },
+                                                                         Error_Stacktrace::capture( skip + 1 ) );
+        }
+#endif
+
+    private:
+
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION )
+        /// Location of the `fail()` call that created the error
+        std::source_location m_origin{};
+#endif
+
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+        /// First sites the error propagated through
+        std::array<std::source_location,TERMINUS_OUTCOME_PROPAGATION_SITES> m_sites{};
+
+        /// Number of sites the error propagated through
+        std::uint32_t m_site_count{ 0 };
+#endif
+
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+        /// Stack at the time the error was created
+        std::shared_ptr<const Error_Stacktrace> m_stacktrace;
+#endif
+
+}; // End of Error_Trace Class
+
+} // End of tmns::outcome::impl namespace
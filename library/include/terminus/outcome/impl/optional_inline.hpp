@@ -0,0 +1,524 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    optional_inline.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * `Optional` for types with an `Optional_Niche`, packed into the value.  Shared by both backends,
+ * which include it after their own `Optional`.
+ * Include `terminus/outcome/optional.hpp` rather than this file.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::outcome {
+
+/**
+ * A value of `ValueT` that `Optional<ValueT>` uses to mean "empty", so it needs no separate flag
+ * and is no larger than `ValueT`.  Specializations provide:
+ *
+ * - `static constexpr ValueT empty_value() noexcept;`
+ * - `static constexpr bool is_empty( const ValueT& value ) noexcept;`
+ *
+ * Pointers use null, and `float` and `double` use a quiet NaN whose payload no arithmetic
+ * produces.  Enumerations and integers have no value to spare, so declare one with
+ * `Optional_Sentinel` before `Optional` of the type is used:
+ *
+ * @code
+ * template <>
+ * struct tmns::outcome::Optional_Niche<Tile_Id> : tmns::outcome::Optional_Sentinel<Tile_Id,Tile_Id::INVALID> {};
+ * @endcode
+ *
+ * The empty value cannot be stored: an `Optional` given it is empty.  Only trivially copyable
+ * types are packed; other types, and types without a niche, use the backend's `Optional`.
+ */
+template <class ValueT>
+struct Optional_Niche {};
+
+/**
+ * `Optional_Niche` that reserves the value `cSentinel`.
+ */
+template <class ValueT, ValueT cSentinel>
+struct Optional_Sentinel
+{
+    static constexpr ValueT empty_value() noexcept
+    {
+        return cSentinel;
+    }
+
+    static constexpr bool is_empty( const ValueT& value ) noexcept
+    {
+        return value == cSentinel;
+    }
+};
+
+/**
+ * Null pointers are empty.
+ */
+template <class ValueT>
+struct Optional_Niche<ValueT*> : Optional_Sentinel<ValueT*,nullptr> {};
+
+/**
+ * A quiet NaN with the payload "NONE" (or "NO" for `float`) is empty.  Any other NaN is a value.
+ */
+template <class ValueT>
+  requires ( std::same_as<ValueT,float> || std::same_as<ValueT,double> )
+struct Optional_Niche<ValueT>
+{
+    using Bits = std::conditional_t<sizeof( ValueT ) == 4, std::uint32_t, std::uint64_t>;
+
+    static constexpr Bits cEmptyBits = sizeof( ValueT ) == 4 ? Bits( 0x7FC0'4E4F ) : Bits( 0x7FF8'4E4F'4E45'0000 );
+
+    static constexpr ValueT empty_value() noexcept
+    {
+        return std::bit_cast<ValueT>( cEmptyBits );
+    }
+
+    static constexpr bool is_empty( const ValueT& value ) noexcept
+    {
+        return std::bit_cast<Bits>( value ) == cEmptyBits;
+    }
+};
+
+namespace impl {
+
+/**
+ * @brief Check whether `ValueT` declares an `Optional_Niche`.
+ */
+template <class ValueT>
+concept Has_Optional_Niche = std::is_trivially_copyable_v<ValueT> && requires( const ValueT& v )
+{
+    { Optional_Niche<ValueT>::empty_value() } -> std::same_as<ValueT>;
+    { Optional_Niche<ValueT>::is_empty( v ) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Check whether `Optional<ValueT>` is the inline specialization.
+ *
+ * Only types with a niche use it, in both backends, so every other type keeps the full
+ * interface of `boost::optional` or `std::optional`.
+ */
+template <class ValueT>
+concept Uses_Inline_Optional = !std::is_reference_v<ValueT>
+                            && !std::is_array_v<ValueT>
+                            && !std::is_const_v<ValueT>
+                            && Has_Optional_Niche<ValueT>;
+
+/**
+ * Storage of an inline `Optional`: just the value, holding the niche while empty.
+ */
+template <class ValueT>
+class Optional_Storage
+{
+    public:
+
+        constexpr Optional_Storage() noexcept = default;
+
+        template <class... ArgsT>
+        constexpr explicit Optional_Storage( std::in_place_t, ArgsT&&... args )
+          : m_value( std::forward<ArgsT>( args )... )
+        {}
+
+        constexpr bool engaged() const noexcept
+        {
+            return !Optional_Niche<ValueT>::is_empty( m_value );
+        }
+
+        constexpr ValueT& get() noexcept
+        {
+            return m_value;
+        }
+
+        constexpr const ValueT& get() const noexcept
+        {
+            return m_value;
+        }
+
+        template <class... ArgsT>
+        constexpr void set( ArgsT&&... args )
+        {
+            m_value = ValueT( std::forward<ArgsT>( args )... );
+        }
+
+        constexpr void clear() noexcept
+        {
+            m_value = Optional_Niche<ValueT>::empty_value();
+        }
+
+    private:
+
+        /// Value, or the niche's empty value
+        ValueT m_value{ Optional_Niche<ValueT>::empty_value() };
+
+}; // End of Optional_Storage Class
+
+} // End of impl namespace
+
+/**
+ * @brief `Optional` of a type with an `Optional_Niche`, packed into the value.
+ *
+ * It is trivially copyable, and `Optional<double>` and `Optional<Tile*>` are the size of the
+ * value.  The interface is that of
+ * `std::optional` plus the `boost::optional` accessors `get()`, `get_ptr()` and
+ * `is_initialized()`, with the same `std::optional` bridge as the other `Optional`s.
+ *
+ * @tparam ValueT Value type stored by the optional.
+ */
+template <class ValueT>
+  requires impl::Uses_Inline_Optional<ValueT>
+class Optional<ValueT>
+{
+    public:
+
+        using value_type = ValueT;
+
+        /// Type alias capturing the value type
+        using ValueType = ValueT;
+
+        /// Type alias capturing the decayed value type (used in `std::optional` conversions)
+        using DecayedValueType = std::decay_t<ValueT>;
+
+        /**
+         * @brief Construct an empty optional.
+         */
+        constexpr Optional() noexcept = default;
+
+        /**
+         * @brief Construct an empty optional.
+         */
+        constexpr Optional( Empty ) noexcept {}
+
+        /**
+         * @brief Construct the value in place.
+         */
+        template <class... ArgsT>
+          requires std::constructible_from<ValueT,ArgsT&&...>
+        constexpr explicit Optional( std::in_place_t, ArgsT&&... args )
+          : m_storage{ std::in_place, std::forward<ArgsT>( args )... }
+        {}
+
+        /**
+         * @brief Construct an optional holding `v`.
+         */
+        template <class UValueT = ValueT>
+          requires ( std::constructible_from<ValueT,UValueT&&>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,Optional>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,Empty>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,std::in_place_t>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,std::optional<ValueT>> )
+        constexpr explicit( !std::is_convertible_v<UValueT&&,ValueT> ) Optional( UValueT&& v )
+          : m_storage{ std::in_place, std::forward<UValueT>( v ) }
+        {}
+
+        /**
+         * @brief Copy-converting constructor that initializes from a `std::optional`.
+         *
+         * @param stdopt Source optional whose contained value is copied when present.
+        */
+        constexpr explicit Optional( const std::optional<ValueT>& stdopt ) noexcept
+        {
+            if( stdopt.has_value() )
+            {
+                m_storage.set( *stdopt );
+            }
+        }
+
+        /**
+         * @brief Move-converting constructor from a `std::optional` rvalue.  A trivially
+         *        copyable value is copied, so the source is left as it was.
+        */
+        constexpr explicit Optional( std::optional<ValueT>&& stdopt ) noexcept
+          : Optional( std::as_const( stdopt ) )
+        {}
+
+        /**
+         * @brief Make the optional empty.
+         */
+        constexpr Optional& operator = ( Empty ) noexcept
+        {
+            m_storage.clear();
+            return *this;
+        }
+
+        /**
+         * @brief Assign a value.
+         */
+        template <class UValueT = ValueT>
+          requires ( std::constructible_from<ValueT,UValueT&&>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,Optional>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,Empty>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,std::optional<ValueT>> )
+        constexpr Optional& operator = ( UValueT&& v )
+        {
+            m_storage.set( std::forward<UValueT>( v ) );
+            return *this;
+        }
+
+        /**
+         * @brief Copy assignment operator that synchronizes with a `std::optional`.
+         *
+         * @param stdopt Source optional whose value is copied when present.
+         * @return Reference to `*this`.
+         */
+        constexpr Optional& operator = ( const std::optional<ValueT>& stdopt ) noexcept
+        {
+            if( stdopt.has_value() )
+            {
+                m_storage.set( *stdopt );
+            }
+            else
+            {
+                m_storage.clear();
+            }
+            return *this;
+        }
+
+        constexpr bool has_value() const noexcept
+        {
+            return m_storage.engaged();
+        }
+
+        constexpr bool is_initialized() const noexcept
+        {
+            return m_storage.engaged();
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_storage.engaged();
+        }
+
+        /**
+         * @brief Checked access to the value.
+         *
+         * @throws The backend's `bad_optional_access` if the optional is empty.
+         */
+        constexpr ValueT& value() &
+        {
+            check_value();
+            return m_storage.get();
+        }
+
+        constexpr const ValueT& value() const&
+        {
+            check_value();
+            return m_storage.get();
+        }
+
+        constexpr ValueT&& value() &&
+        {
+            check_value();
+            return std::move( m_storage.get() );
+        }
+
+        template <class UValueT>
+        constexpr ValueT value_or( UValueT&& fallback ) const
+        {
+            return has_value() ? m_storage.get() : static_cast<ValueT>( std::forward<UValueT>( fallback ) );
+        }
+
+        constexpr ValueT& operator * () & noexcept
+        {
+            return m_storage.get();
+        }
+
+        constexpr const ValueT& operator * () const& noexcept
+        {
+            return m_storage.get();
+        }
+
+        constexpr ValueT&& operator * () && noexcept
+        {
+            return std::move( m_storage.get() );
+        }
+
+        constexpr ValueT* operator -> () noexcept
+        {
+            return std::addressof( m_storage.get() );
+        }
+
+        constexpr const ValueT* operator -> () const noexcept
+        {
+            return std::addressof( m_storage.get() );
+        }
+
+        /**
+         * @brief Unchecked access to the value.
+         */
+        constexpr ValueT& get() noexcept
+        {
+            return m_storage.get();
+        }
+
+        constexpr const ValueT& get() const noexcept
+        {
+            return m_storage.get();
+        }
+
+        /**
+         * @brief Get a pointer to the value, or null if there is none.
+         */
+        constexpr ValueT* get_ptr() noexcept
+        {
+            return has_value() ? std::addressof( m_storage.get() ) : nullptr;
+        }
+
+        constexpr const ValueT* get_ptr() const noexcept
+        {
+            return has_value() ? std::addressof( m_storage.get() ) : nullptr;
+        }
+
+        /**
+         * @brief Replace the value with one constructed from `args`.
+         */
+        template <class... ArgsT>
+        constexpr ValueT& emplace( ArgsT&&... args )
+        {
+            m_storage.set( std::forward<ArgsT>( args )... );
+            return m_storage.get();
+        }
+
+        constexpr void reset() noexcept
+        {
+            m_storage.clear();
+        }
+
+        constexpr void swap( Optional& rhs ) noexcept
+        {
+            std::swap( m_storage, rhs.m_storage );
+        }
+
+        /**
+         * @brief Apply `fn` to the value, if any, and return its result as an `Optional`.
+         */
+        template <class FunctionT>
+        constexpr auto transform( FunctionT&& fn ) const
+        {
+            using U = std::remove_cv_t<std::invoke_result_t<FunctionT,const ValueT&>>;
+            if( has_value() )
+            {
+                return Optional<U>( std::invoke( std::forward<FunctionT>( fn ), m_storage.get() ) );
+            }
+            return Optional<U>();
+        }
+
+        /**
+         * @brief Apply `fn`, which returns an optional, to the value, if any.
+         */
+        template <class FunctionT>
+        constexpr auto and_then( FunctionT&& fn ) const
+        {
+            using U = std::remove_cvref_t<std::invoke_result_t<FunctionT,const ValueT&>>;
+            if( has_value() )
+            {
+                return std::invoke( std::forward<FunctionT>( fn ), m_storage.get() );
+            }
+            return U();
+        }
+
+        /**
+         * @brief Return the optional if it has a value, or else the optional `fn` returns.
+         */
+        template <class FunctionT>
+        constexpr Optional or_else( FunctionT&& fn ) const
+        {
+            if( has_value() )
+            {
+                return *this;
+            }
+            return std::invoke( std::forward<FunctionT>( fn ) );
+        }
+
+        /**
+         * @brief Conversion operator that produces a `std::optional` copy of the value.
+         */
+        constexpr operator std::optional<DecayedValueType>() const noexcept
+        {
+            if( has_value() )
+            {
+                return std::optional<DecayedValueType>{ m_storage.get() };
+            }
+            return std::nullopt;
+        }
+
+    private:
+
+        constexpr void check_value() const
+        {
+            if( !has_value() )
+            {
+                impl::throw_bad_optional_access();
+            }
+        }
+
+        /// Value and whether there is one
+        impl::Optional_Storage<ValueT> m_storage;
+
+}; // End of Optional Class
+
+/**
+ * Comparisons of inline optionals.  Like those of `std::optional`, they are templates, so
+ * arguments are not converted to `Optional` to match them.
+ */
+template <class ValueT>
+  requires ( impl::Uses_Inline_Optional<ValueT> && std::equality_comparable<ValueT> )
+constexpr bool operator == ( const Optional<ValueT>& lhs, const Optional<ValueT>& rhs )
+{
+    if( lhs.has_value() != rhs.has_value() )
+    {
+        return false;
+    }
+    return !lhs.has_value() || *lhs == *rhs;
+}
+
+template <class ValueT>
+  requires impl::Uses_Inline_Optional<ValueT>
+constexpr bool operator == ( const Optional<ValueT>& lhs, Empty ) noexcept
+{
+    return !lhs.has_value();
+}
+
+template <class ValueT, class UValueT>
+  requires ( impl::Uses_Inline_Optional<ValueT>
+          && !std::same_as<UValueT,Optional<ValueT>>
+          && !std::same_as<UValueT,Empty>
+          && requires( const ValueT& v, const UValueT& u ) { { v == u } -> std::convertible_to<bool>; } )
+constexpr bool operator == ( const Optional<ValueT>& lhs, const UValueT& rhs )
+{
+    return lhs.has_value() && *lhs == rhs;
+}
+
+/**
+ * @brief Order like `std::optional`: empty before any value.
+ */
+template <class ValueT>
+  requires ( impl::Uses_Inline_Optional<ValueT> && std::three_way_comparable<ValueT> )
+constexpr std::compare_three_way_result_t<ValueT> operator <=> ( const Optional<ValueT>& lhs, const Optional<ValueT>& rhs )
+{
+    using Ordering = std::compare_three_way_result_t<ValueT>;
+    if( lhs.has_value() && rhs.has_value() )
+    {
+        return Ordering( *lhs <=> *rhs );
+    }
+    return Ordering( lhs.has_value() <=> rhs.has_value() );
+}
+
+} // End of tmns::outcome namespace
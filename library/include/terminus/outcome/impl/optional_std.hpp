@@ -0,0 +1,311 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    optional_std.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * `Optional` implemented on `std::optional`.  Selected by defining
+ * `TERMINUS_OUTCOME_USE_STD_BACKEND`.  Types with an `Optional_Niche` use the inline `Optional`
+ * in `optional_inline.hpp` instead.  Include `terminus/outcome/optional.hpp` rather than this file.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/panic.hpp>
+
+namespace tmns::outcome {
+
+/// Type tag to help construct an empty `Optional` instance.
+using Empty = std::nullopt_t;
+
+/// Value used to tag-construct an empty `Optional` instance.
+inline constexpr Empty cEmpty = std::nullopt;
+
+namespace impl {
+
+/**
+ * @brief Throw the exception `std::optional::value()` throws on an empty optional, or call the
+ *        panic handler with it.
+ */
+[[noreturn]] inline void throw_bad_optional_access()
+{
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    raise_panic( std::bad_optional_access() );
+#else
+    throw std::bad_optional_access();
+#endif
+}
+
+} // End of impl namespace
+
+/**
+ * @brief `std::optional` with the interface of the Boost backend's `Optional`.
+ *
+ * Besides the `std::optional` API, this adds the `boost::optional` accessors the Boost backend
+ * offers (`get()`, `get_ptr()` and `is_initialized()`), so code compiles against either backend.
+ * Converting to and from `std::optional` is free, since it is the base class.
+ *
+ * @tparam ValueT Value type stored by the optional.
+ */
+template <class ValueT>
+class Optional : public std::optional<ValueT>
+{
+    public:
+
+        /// Type alias capturing the value type
+        using ValueType = ValueT;
+
+        /// Type alias capturing the decayed value type (used in `std::optional` conversions)
+        using DecayedValueType = std::decay_t<ValueT>;
+
+        // Inherit all std optional constructors and assignments
+        using std::optional<ValueT>::optional;
+        using std::optional<ValueT>::operator=;
+
+        /**
+         * @brief Copy-converting constructor that initializes from a `std::optional`.
+         *
+         * @param stdopt Source optional whose contained value is copied when present.
+        */
+        explicit Optional( const std::optional<ValueT>& stdopt )
+        requires std::copy_constructible<ValueT>
+          : std::optional<ValueT>( stdopt )
+        {}
+
+        /**
+         * @brief Move-converting constructor that transfers state from a `std::optional` rvalue.
+        */
+        explicit Optional( std::optional<ValueT>&& stdopt )
+        requires std::move_constructible<ValueT>
+          : std::optional<ValueT>( std::move( stdopt ) )
+        {}
+
+        /**
+         * @brief Check whether the optional holds a value.
+         */
+        constexpr bool is_initialized() const noexcept
+        {
+            return this->has_value();
+        }
+
+        /**
+         * @brief Unchecked access to the value.
+         */
+        constexpr ValueT& get() & noexcept
+        {
+            return **this;
+        }
+
+        constexpr const ValueT& get() const& noexcept
+        {
+            return **this;
+        }
+
+        constexpr ValueT&& get() && noexcept
+        {
+            return *std::move( *this );
+        }
+
+        /**
+         * @brief Get a pointer to the value, or null if there is none.
+         */
+        constexpr ValueT* get_ptr() noexcept
+        {
+            return this->has_value() ? std::addressof( **this ) : nullptr;
+        }
+
+        constexpr const ValueT* get_ptr() const noexcept
+        {
+            return this->has_value() ? std::addressof( **this ) : nullptr;
+        }
+
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+        /**
+         * @brief Checked access to the value, calling the panic handler if there is none.
+         */
+        constexpr decltype(auto) value() &
+        {
+            if( !this->has_value() )
+            {
+                impl::throw_bad_optional_access();
+            }
+            return **this;
+        }
+
+        constexpr decltype(auto) value() const&
+        {
+            if( !this->has_value() )
+            {
+                impl::throw_bad_optional_access();
+            }
+            return **this;
+        }
+
+        constexpr decltype(auto) value() &&
+        {
+            if( !this->has_value() )
+            {
+                impl::throw_bad_optional_access();
+            }
+            return std::move( **this );
+        }
+#endif
+
+}; // End of Optional Class
+
+/**
+ * @brief Specialization of `Optional` for references, which `std::optional` does not support.
+ *
+ * Behaves like `boost::optional<T&>`: it stores a pointer to the referenced object, and
+ * assigning a new reference rebinds it rather than assigning through it.
+ *
+ * @tparam ValueT Referenced type.
+ */
+template <class ValueT>
+class Optional<ValueT&>
+{
+    public:
+
+        /// Type alias capturing the value type
+        using ValueType = ValueT&;
+
+        /// Type alias capturing the decayed value type (used in `std::optional` conversions)
+        using DecayedValueType = std::decay_t<ValueT>;
+
+        /**
+         * @brief Construct an empty optional.
+         */
+        constexpr Optional() noexcept = default;
+
+        /**
+         * @brief Construct an empty optional.
+         */
+        constexpr Optional( Empty ) noexcept {}
+
+        /**
+         * @brief Construct an optional referring to `v`.
+         */
+        constexpr Optional( ValueT& v ) noexcept
+          : m_ptr{ std::addressof( v ) }
+        {}
+
+        /// Binding to a temporary would dangle.
+        Optional( ValueT&& ) = delete;
+
+        /**
+         * @brief Make the optional empty.
+         */
+        constexpr Optional& operator = ( Empty ) noexcept
+        {
+            m_ptr = nullptr;
+            return *this;
+        }
+
+        constexpr bool has_value() const noexcept
+        {
+            return m_ptr != nullptr;
+        }
+
+        constexpr bool is_initialized() const noexcept
+        {
+            return m_ptr != nullptr;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_ptr != nullptr;
+        }
+
+        /**
+         * @brief Checked access to the referenced object.
+         *
+         * @throws std::bad_optional_access if the optional is empty.
+         */
+        constexpr ValueT& value() const
+        {
+            if( m_ptr == nullptr )
+            {
+                impl::throw_bad_optional_access();
+            }
+            return *m_ptr;
+        }
+
+        constexpr ValueT& get() const noexcept
+        {
+            return *m_ptr;
+        }
+
+        constexpr ValueT* get_ptr() const noexcept
+        {
+            return m_ptr;
+        }
+
+        constexpr ValueT& operator * () const noexcept
+        {
+            return *m_ptr;
+        }
+
+        constexpr ValueT* operator -> () const noexcept
+        {
+            return m_ptr;
+        }
+
+        constexpr ValueT& value_or( ValueT& fallback ) const noexcept
+        {
+            return m_ptr != nullptr ? *m_ptr : fallback;
+        }
+
+        /**
+         * @brief Rebind the optional to `v`.
+         */
+        constexpr ValueT& emplace( ValueT& v ) noexcept
+        {
+            m_ptr = std::addressof( v );
+            return *m_ptr;
+        }
+
+        constexpr void reset() noexcept
+        {
+            m_ptr = nullptr;
+        }
+
+        /**
+         * @brief Copy-conversion operator that produces a `std::optional` holding a copy of the
+         *        referenced object.
+         */
+        operator std::optional<DecayedValueType>() const
+        requires std::copy_constructible<DecayedValueType>
+        {
+            if( m_ptr != nullptr )
+            {
+                return std::optional<DecayedValueType>{ *m_ptr };
+            }
+            return std::nullopt;
+        }
+
+    private:
+
+        /// Referenced object, or null when empty
+        ValueT* m_ptr{ nullptr };
+
+}; // End of Optional Class
+
+} // End of tmns::outcome namespace
+
+// Optional of types with a niche
+#include <terminus/outcome/impl/optional_inline.hpp>
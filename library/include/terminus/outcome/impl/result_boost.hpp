@@ -0,0 +1,203 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    result_boost.hpp
+ * @author  Marvin Smith
+ * @date    7/7/2023
+ *
+ * `Result` implemented on Boost.Outcome.  This is the default backend.  Include
+ * `terminus/outcome/result.hpp` rather than this file.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <functional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+// Terminus Libraries
+#include <terminus/outcome/panic.hpp>
+
+// Without exceptions, Boost.Outcome's bad accesses go to the panic handler
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS ) && !defined( BOOST_OUTCOME_THROW_EXCEPTION )
+    #define BOOST_OUTCOME_THROW_EXCEPTION( expr ) ::tmns::outcome::impl::raise_panic( expr )
+#endif
+
+// Boost Libraries
+#include <boost/outcome/std_result.hpp>
+#include <boost/outcome/utils.hpp>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/impl/coroutine_return.hpp>
+
+// Namespace alias for the boost outcome namespace
+namespace tmns::outcome::impl {
+    namespace outcome = BOOST_OUTCOME_V2_NAMESPACE;
+
+    /// Success value tagged for conversion into a `Result`
+    template <class ValueT>
+    using Success_Type = outcome::success_type<ValueT>;
+
+    /// Error tagged for conversion into a `Result`
+    template <class ErrorT>
+    using Failure_Type = outcome::failure_type<ErrorT>;
+
+    using outcome::success;
+    using outcome::failure;
+
+} // end of tmns::outcome::impl namespace
+
+namespace tmns::outcome {
+
+/**
+ * Contains the result of an operation that could potentially fail, offering an alternative to
+ * error handling as opposed to exceptions.
+ *
+ * The type is built on top of Boost.Outcome `basic_result` type.  Its API is identical to
+ * that type with one additional enhancement: our `Result` type supports references.
+ *
+ * This result type fits into the standard library's `std::error_code` error handling framework
+ * by using the `Error` type as the failure outcome type for the result.
+ *
+ * @see https://www.boost.org/doc/libs/1_81_0/libs/outcome/doc/html/index.html
+*/
+template <class ValueT, class ErrorCodeT>
+class Result;
+
+/**
+ * Specialization of the `Result` type for non-reference types.  This is basically just a
+ * pass-through to the underlying Boost `result` type.
+*/
+template <typename  ValueT, typename ErrorCodeT>
+  requires( !std::is_lvalue_reference_v<ValueT> )
+class Result<ValueT,ErrorCodeT> : public impl::outcome::std_result<ValueT,Error<ErrorCodeT>>
+{
+    private:
+
+        using BASE_TYPE = impl::outcome::std_result<ValueT,Error<ErrorCodeT>>;
+
+    public:
+        using BASE_TYPE::BASE_TYPE;
+
+        /**
+         * @brief Placeholder returned by a coroutine before its body runs.  See
+         *        `terminus/outcome/coroutine.hpp`.
+         */
+        explicit Result( impl::Coroutine_Return_Tag tag )
+          : BASE_TYPE{ std::in_place_type<Error<ErrorCodeT>>, ErrorCodeT{} }
+        {
+            *tag.target = this;
+        }
+}; // End of Result Class
+
+/**
+ * Specialization of the `Result` type for reference types.  This effectively wraps the non-ref
+ * type of `ValueT` inside of a std::reference_wrapper` and then overloads a few of the public
+ * Boost.Outcome `result` methods to hide the fact that the value is stored inside a wrapper type.
+ *
+ * Note that we don't have to account for the case when `ValueT` is `void` because we can't do
+ * anything with a `void&` type anyways.
+*/
+template <class ValueT, class ErrorCodeT> requires ( std::is_lvalue_reference_v<ValueT> )
+class Result<ValueT,ErrorCodeT>
+     : public impl::outcome::std_result<std::reference_wrapper<std::remove_reference_t<ValueT>>,
+                                    Error<ErrorCodeT>>
+{
+    private:
+
+        using BASE_TYPE = impl::outcome::std_result<std::reference_wrapper<std::remove_reference_t<ValueT>>,
+                                                Error<ErrorCodeT>>;
+
+    public:
+
+        // Expose the inherited constructors
+        using BASE_TYPE::BASE_TYPE;
+
+        /**
+         * @brief Placeholder returned by a coroutine before its body runs.  See
+         *        `terminus/outcome/coroutine.hpp`.
+         */
+        explicit Result( impl::Coroutine_Return_Tag tag )
+          : BASE_TYPE{ std::in_place_type<Error<ErrorCodeT>>, ErrorCodeT{} }
+        {
+            *tag.target = this;
+        }
+
+        /**
+         * Override the base methods for accessing the value so that we can get the value inside the
+         * reference wrapper without making the user call `get()` all over the place.
+        */
+        ValueT& assume_value() &
+        {
+            return BASE_TYPE::assume_value().get();
+        }
+
+        const ValueT& assume_value() const&
+        {
+            return BASE_TYPE::assume_value().get();
+        }
+
+        ValueT&& assume_value() &&
+        {
+            return BASE_TYPE::assume_value().get();
+        }
+
+        const ValueT&& assume_value() const&&
+        {
+            return BASE_TYPE::value().get();
+        }
+
+        ValueT& value() &
+        {
+            return BASE_TYPE::value().get();
+        }
+
+        const ValueT& value() const&
+        {
+            return BASE_TYPE::value().get();
+        }
+
+        ValueT&& value() &&
+        {
+            return BASE_TYPE::value().get();
+        }
+
+        const ValueT&& value() const&&
+        {
+            return BASE_TYPE::value().get();
+        }
+
+}; // End of Result Class
+
+
+/**
+ * Overload that tells the Boost Outcome library how to transform our custom error with a payload
+ * into a `std::system_error` and throw it.  The library needs this in order to successfully use our
+ * custom error type.
+ *
+ * @note Calling this function will always throw an exception, or call the panic handler when
+ *       `TERMINUS_OUTCOME_NO_EXCEPTIONS` is defined.
+ *
+ * @param e The error containing information used to construct a system error and throw it.
+*/
+template <class ErrorCodeT>
+[[noreturn]] inline void outcome_throw_as_system_error_with_payload( Error<ErrorCodeT> e )
+{
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    impl::raise_panic( e.code(), e.details(), e.origin() );
+#else
+    impl::outcome::try_throw_std_exception_from_error( e.code() );
+    throw std::system_error( e.code(), std::string{ e.details() } );
+#endif
+}
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,657 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    result_std.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * `Result` implemented on `std::expected`.  Selected by defining
+ * `TERMINUS_OUTCOME_USE_STD_BACKEND`.  Include `terminus/outcome/result.hpp` rather than this file.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <concepts>
+#include <expected>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/impl/coroutine_return.hpp>
+#include <terminus/outcome/panic.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Overload that transforms our custom error with a payload into a `std::system_error` and throws
+ * it.  `Result::value()` calls this when the result holds an error.
+ *
+ * @note Calling this function will always throw an exception, or call the panic handler when
+ *       `TERMINUS_OUTCOME_NO_EXCEPTIONS` is defined.
+ *
+ * @param e The error containing information used to construct a system error and throw it.
+*/
+template <class ErrorCodeT>
+[[noreturn]] inline void outcome_throw_as_system_error_with_payload( Error<ErrorCodeT> e )
+{
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    impl::raise_panic( e.code(), e.details(), e.origin() );
+#else
+    throw std::system_error( e.code(), std::string{ e.details() } );
+#endif
+}
+
+} // End of tmns::outcome namespace
+
+namespace tmns::outcome::impl {
+
+/**
+ * Success value tagged for conversion into a `Result`, playing the role of Boost.Outcome's
+ * `success_type`.
+ */
+template <class ValueT>
+struct Success_Type
+{
+    /// The success value
+    ValueT value;
+};
+
+/**
+ * Success tag for `Result<void>`.
+ */
+template <>
+struct Success_Type<void> {};
+
+/**
+ * @brief Tag a value as a success.
+ */
+template <class ValueT>
+constexpr Success_Type<std::decay_t<ValueT>> success( ValueT&& v )
+{
+    return { std::forward<ValueT>( v ) };
+}
+
+/**
+ * @brief Tag a `void` success.
+ */
+constexpr Success_Type<void> success() noexcept
+{
+    return {};
+}
+
+/**
+ * Error tagged for conversion into a `Result`, playing the role of Boost.Outcome's
+ * `failure_type`.
+ */
+template <class ErrorT>
+class Failure_Type
+{
+    public:
+
+        template <class UErrorT>
+          requires std::constructible_from<ErrorT,UErrorT>
+        constexpr explicit Failure_Type( UErrorT&& e )
+          : m_error{ std::forward<UErrorT>( e ) }
+        {}
+
+        constexpr ErrorT& error() & noexcept
+        {
+            return m_error;
+        }
+
+        constexpr const ErrorT& error() const& noexcept
+        {
+            return m_error;
+        }
+
+        constexpr ErrorT&& error() && noexcept
+        {
+            return std::move( m_error );
+        }
+
+    private:
+
+        /// The error
+        ErrorT m_error;
+
+}; // End of Failure_Type Class
+
+/**
+ * @brief Tag an error as a failure.
+ */
+template <class ErrorT>
+Failure_Type<std::decay_t<ErrorT>> failure( ErrorT&& e )
+{
+    return Failure_Type<std::decay_t<ErrorT>>{ std::forward<ErrorT>( e ) };
+}
+
+template <class T>
+inline constexpr bool is_success_or_failure_v = false;
+
+template <class T>
+inline constexpr bool is_success_or_failure_v<Success_Type<T>> = true;
+
+template <class T>
+inline constexpr bool is_success_or_failure_v<Failure_Type<T>> = true;
+
+/**
+ * Storage and error-side API shared by the `Result` specializations.
+ *
+ * The member functions mirror the Boost.Outcome `basic_result` API that the Boost backend
+ * exposes, so code compiles against either backend.  `value()` on a failed result throws through
+ * `outcome_throw_as_system_error_with_payload()`, and `error()` on a successful result throws a
+ * `std::logic_error`, like Boost.Outcome's `bad_result_access`.
+ *
+ * @tparam StoredT   Type stored in the `std::expected` on success.
+ * @tparam ErrorCodeT Error code enumeration of the `Error`.
+ */
+template <class StoredT, class ErrorCodeT>
+class Result_Base
+{
+    public:
+
+        using error_type = Error<ErrorCodeT>;
+
+        /**
+         * @brief Construct a failed result.  Disabled when the success type could also be
+         *        constructed from the error, as in Boost.Outcome.
+         */
+        constexpr Result_Base( const error_type& e )
+          requires ( !std::is_constructible_v<StoredT,const error_type&> )
+          : m_storage{ std::unexpect, e }
+        {}
+
+        /**
+         * @brief Construct a failed result.
+         */
+        constexpr Result_Base( error_type&& e )
+          requires ( !std::is_constructible_v<StoredT,error_type&&> )
+          : m_storage{ std::unexpect, std::move( e ) }
+        {}
+
+        /**
+         * @brief Construct a failed result from a tagged failure, such as `fail( ... )`.
+         */
+        template <class UErrorT>
+          requires std::constructible_from<error_type,UErrorT&&>
+        constexpr Result_Base( Failure_Type<UErrorT>&& f )
+          : m_storage{ std::unexpect, std::move( f ).error() }
+        {}
+
+        /**
+         * @brief Construct a failed result from a tagged failure.
+         */
+        template <class UErrorT>
+          requires std::constructible_from<error_type,const UErrorT&>
+        constexpr Result_Base( const Failure_Type<UErrorT>& f )
+          : m_storage{ std::unexpect, f.error() }
+        {}
+
+        /**
+         * @brief Construct a failed result in place.
+         */
+        template <class... ArgsT>
+        constexpr explicit Result_Base( std::in_place_type_t<error_type>, ArgsT&&... args )
+          : m_storage{ std::unexpect, std::forward<ArgsT>( args )... }
+        {}
+
+        constexpr bool has_value() const noexcept
+        {
+            return m_storage.has_value();
+        }
+
+        constexpr bool has_error() const noexcept
+        {
+            return !m_storage.has_value();
+        }
+
+        constexpr bool has_failure() const noexcept
+        {
+            return !m_storage.has_value();
+        }
+
+        constexpr bool has_exception() const noexcept
+        {
+            return false;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_storage.has_value();
+        }
+
+        constexpr error_type& assume_error() & noexcept
+        {
+            return m_storage.error();
+        }
+
+        constexpr const error_type& assume_error() const& noexcept
+        {
+            return m_storage.error();
+        }
+
+        constexpr error_type&& assume_error() && noexcept
+        {
+            return std::move( m_storage ).error();
+        }
+
+        constexpr const error_type&& assume_error() const&& noexcept
+        {
+            return std::move( m_storage ).error();
+        }
+
+        constexpr error_type& error() &
+        {
+            check_error();
+            return m_storage.error();
+        }
+
+        constexpr const error_type& error() const&
+        {
+            check_error();
+            return m_storage.error();
+        }
+
+        constexpr error_type&& error() &&
+        {
+            check_error();
+            return std::move( m_storage ).error();
+        }
+
+        constexpr const error_type&& error() const&&
+        {
+            check_error();
+            return std::move( m_storage ).error();
+        }
+
+        /**
+         * @brief Return the error tagged as a failure, for returning it from a function with a
+         *        different success type.
+         */
+        constexpr Failure_Type<error_type> as_failure() const&
+        {
+            return Failure_Type<error_type>{ assume_error() };
+        }
+
+        constexpr Failure_Type<error_type> as_failure() &&
+        {
+            return Failure_Type<error_type>{ std::move( m_storage ).error() };
+        }
+
+        constexpr void swap( Result_Base& rhs ) noexcept
+        {
+            m_storage.swap( rhs.m_storage );
+        }
+
+        /**
+         * @brief Results are equal when both hold equal values or both hold equal errors, as in
+         *        Boost.Outcome.
+         */
+        template <class UStoredT>
+          requires requires ( const std::expected<StoredT,error_type>& lhs,
+                              const std::expected<UStoredT,error_type>& rhs ) { { lhs == rhs } -> std::convertible_to<bool>; }
+        constexpr bool operator == ( const Result_Base<UStoredT,ErrorCodeT>& rhs ) const
+        {
+            return m_storage == rhs.m_storage;
+        }
+
+    protected:
+
+        template <class OtherStoredT, class OtherErrorCodeT>
+        friend class Result_Base;
+
+        /**
+         * @brief Construct from storage built by a converting constructor.
+         */
+        constexpr explicit Result_Base( std::expected<StoredT,error_type>&& storage )
+          : m_storage{ std::move( storage ) }
+        {}
+
+        /**
+         * @brief Construct a successful result in place.
+         */
+        template <class... ArgsT>
+        constexpr explicit Result_Base( std::in_place_t, ArgsT&&... args )
+          : m_storage{ std::in_place, std::forward<ArgsT>( args )... }
+        {}
+
+        /**
+         * @brief Throw the error if the result does not hold a value.
+         */
+        constexpr void check_value() const
+        {
+            if( !m_storage.has_value() )
+            {
+                outcome_throw_as_system_error_with_payload( m_storage.error() );
+            }
+        }
+
+        /**
+         * @brief Throw if the result does not hold an error.
+         */
+        constexpr void check_error() const
+        {
+            if( m_storage.has_value() )
+            {
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+                impl::raise_panic( std::logic_error( "no error" ) );
+#else
+                throw std::logic_error( "no error" );
+#endif
+            }
+        }
+
+        /// Value or error
+        std::expected<StoredT,error_type> m_storage;
+
+}; // End of Result_Base Class
+
+} // End of tmns::outcome::impl namespace
+
+namespace tmns::outcome {
+
+/**
+ * Contains the result of an operation that could potentially fail, offering an alternative to
+ * error handling as opposed to exceptions.
+ *
+ * This backend stores the result in a `std::expected` and exposes the same API as the Boost.Outcome
+ * based `Result`, including support for references.
+ *
+ * This result type fits into the standard library's `std::error_code` error handling framework
+ * by using the `Error` type as the failure outcome type for the result.
+*/
+template <class ValueT, class ErrorCodeT>
+class Result;
+
+/**
+ * Specialization of the `Result` type for non-reference, non-void types.
+*/
+template <class ValueT, class ErrorCodeT>
+  requires ( !std::is_lvalue_reference_v<ValueT> && !std::is_void_v<ValueT> )
+class Result<ValueT,ErrorCodeT> : public impl::Result_Base<ValueT,ErrorCodeT>
+{
+    private:
+
+        using BASE_TYPE    = impl::Result_Base<ValueT,ErrorCodeT>;
+        using STORAGE_TYPE = std::expected<ValueT,Error<ErrorCodeT>>;
+
+    public:
+
+        using value_type = ValueT;
+        using typename BASE_TYPE::error_type;
+
+        // Expose the failure constructors
+        using BASE_TYPE::BASE_TYPE;
+
+        /**
+         * @brief Placeholder returned by a coroutine before its body runs.  See
+         *        `terminus/outcome/coroutine.hpp`.
+         */
+        explicit Result( impl::Coroutine_Return_Tag tag )
+          : BASE_TYPE{ std::in_place_type<error_type>, ErrorCodeT{} }
+        {
+            *tag.target = this;
+        }
+
+        /**
+         * @brief Construct a successful result.  Disabled when the error could also be
+         *        constructed from the value, as in Boost.Outcome.
+         */
+        template <class UValueT>
+          requires ( std::constructible_from<ValueT,UValueT&&>
+                  && !std::is_constructible_v<error_type,UValueT&&>
+                  && !std::same_as<std::remove_cvref_t<UValueT>,Result>
+                  && !impl::is_success_or_failure_v<std::remove_cvref_t<UValueT>> )
+        constexpr explicit( !std::is_convertible_v<UValueT&&,ValueT> ) Result( UValueT&& v )
+          : BASE_TYPE{ std::in_place, std::forward<UValueT>( v ) }
+        {}
+
+        /**
+         * @brief Construct a successful result from a tagged success, such as `ok<T>( ... )`.
+         */
+        template <class UValueT>
+          requires std::constructible_from<ValueT,UValueT&&>
+        constexpr Result( impl::Success_Type<UValueT>&& s )
+          : BASE_TYPE{ std::in_place, std::move( s.value ) }
+        {}
+
+        /**
+         * @brief Construct a successful result in place.
+         */
+        template <class... ArgsT>
+        constexpr explicit Result( std::in_place_type_t<ValueT>, ArgsT&&... args )
+          : BASE_TYPE{ std::in_place, std::forward<ArgsT>( args )... }
+        {}
+
+        /**
+         * @brief Convert a result with another value type, like Boost.Outcome's explicit
+         *        compatible conversion.
+         */
+        template <class UValueT>
+          requires ( !std::same_as<UValueT,ValueT> && !std::is_void_v<UValueT>
+                  && std::constructible_from<ValueT,decltype( std::declval<const Result<UValueT,ErrorCodeT>&>().assume_value() )> )
+        constexpr explicit Result( const Result<UValueT,ErrorCodeT>& rhs )
+          : BASE_TYPE{ rhs.has_value() ? STORAGE_TYPE{ std::in_place, rhs.assume_value() }
+                                       : STORAGE_TYPE{ std::unexpect, rhs.assume_error() } }
+        {}
+
+        /**
+         * @brief Convert a result with another value type, moving its value or error.
+         */
+        template <class UValueT>
+          requires ( !std::same_as<UValueT,ValueT> && !std::is_void_v<UValueT>
+                  && std::constructible_from<ValueT,decltype( std::declval<Result<UValueT,ErrorCodeT>&&>().assume_value() )> )
+        constexpr explicit Result( Result<UValueT,ErrorCodeT>&& rhs )
+          : BASE_TYPE{ rhs.has_value() ? STORAGE_TYPE{ std::in_place, std::move( rhs ).assume_value() }
+                                       : STORAGE_TYPE{ std::unexpect, std::move( rhs ).assume_error() } }
+        {}
+
+        constexpr ValueT& assume_value() & noexcept
+        {
+            return *this->m_storage;
+        }
+
+        constexpr const ValueT& assume_value() const& noexcept
+        {
+            return *this->m_storage;
+        }
+
+        constexpr ValueT&& assume_value() && noexcept
+        {
+            return *std::move( this->m_storage );
+        }
+
+        constexpr const ValueT&& assume_value() const&& noexcept
+        {
+            return *std::move( this->m_storage );
+        }
+
+        constexpr ValueT& value() &
+        {
+            this->check_value();
+            return *this->m_storage;
+        }
+
+        constexpr const ValueT& value() const&
+        {
+            this->check_value();
+            return *this->m_storage;
+        }
+
+        constexpr ValueT&& value() &&
+        {
+            this->check_value();
+            return *std::move( this->m_storage );
+        }
+
+        constexpr const ValueT&& value() const&&
+        {
+            this->check_value();
+            return *std::move( this->m_storage );
+        }
+
+}; // End of Result Class
+
+/**
+ * Specialization of the `Result` type for operations that produce no value.
+*/
+template <class ErrorCodeT>
+class Result<void,ErrorCodeT> : public impl::Result_Base<void,ErrorCodeT>
+{
+    private:
+
+        using BASE_TYPE = impl::Result_Base<void,ErrorCodeT>;
+
+    public:
+
+        using value_type = void;
+        using typename BASE_TYPE::error_type;
+
+        // Expose the failure constructors
+        using BASE_TYPE::BASE_TYPE;
+
+        /**
+         * @brief Placeholder returned by a coroutine before its body runs.  See
+         *        `terminus/outcome/coroutine.hpp`.
+         */
+        explicit Result( impl::Coroutine_Return_Tag tag )
+          : BASE_TYPE{ std::in_place_type<error_type>, ErrorCodeT{} }
+        {
+            *tag.target = this;
+        }
+
+        /**
+         * @brief Construct a successful result from `ok()`.
+         */
+        constexpr Result( impl::Success_Type<void> )
+          : BASE_TYPE{ std::in_place }
+        {}
+
+        /**
+         * @brief Construct a successful result.
+         */
+        constexpr explicit Result( std::in_place_type_t<void> )
+          : BASE_TYPE{ std::in_place }
+        {}
+
+        constexpr void assume_value() const noexcept {}
+
+        constexpr void value() const
+        {
+            this->check_value();
+        }
+
+}; // End of Result Class
+
+/**
+ * Specialization of the `Result` type for reference types.  The referenced object is stored
+ * in a `std::reference_wrapper`, which the value accessors unwrap.
+*/
+template <class ValueT, class ErrorCodeT>
+  requires ( std::is_lvalue_reference_v<ValueT> )
+class Result<ValueT,ErrorCodeT>
+     : public impl::Result_Base<std::reference_wrapper<std::remove_reference_t<ValueT>>,ErrorCodeT>
+{
+    private:
+
+        using WRAPPER_TYPE = std::reference_wrapper<std::remove_reference_t<ValueT>>;
+        using BASE_TYPE    = impl::Result_Base<WRAPPER_TYPE,ErrorCodeT>;
+
+    public:
+
+        using value_type = WRAPPER_TYPE;
+        using typename BASE_TYPE::error_type;
+
+        // Expose the failure constructors
+        using BASE_TYPE::BASE_TYPE;
+
+        /**
+         * @brief Placeholder returned by a coroutine before its body runs.  See
+         *        `terminus/outcome/coroutine.hpp`.
+         */
+        explicit Result( impl::Coroutine_Return_Tag tag )
+          : BASE_TYPE{ std::in_place_type<error_type>, ErrorCodeT{} }
+        {
+            *tag.target = this;
+        }
+
+        /**
+         * @brief Construct a successful result referring to `v`.
+         */
+        constexpr Result( ValueT v ) noexcept
+          : BASE_TYPE{ std::in_place, v }
+        {}
+
+        /**
+         * @brief Construct a successful result from a reference wrapper.
+         */
+        constexpr Result( WRAPPER_TYPE v ) noexcept
+          : BASE_TYPE{ std::in_place, v }
+        {}
+
+        /**
+         * @brief Construct a successful result from a tagged reference wrapper.
+         */
+        constexpr Result( impl::Success_Type<WRAPPER_TYPE>&& s ) noexcept
+          : BASE_TYPE{ std::in_place, s.value }
+        {}
+
+        constexpr ValueT& assume_value() &
+        {
+            return this->m_storage->get();
+        }
+
+        constexpr const ValueT& assume_value() const&
+        {
+            return this->m_storage->get();
+        }
+
+        constexpr ValueT&& assume_value() &&
+        {
+            return this->m_storage->get();
+        }
+
+        constexpr const ValueT&& assume_value() const&&
+        {
+            return this->m_storage->get();
+        }
+
+        constexpr ValueT& value() &
+        {
+            this->check_value();
+            return this->m_storage->get();
+        }
+
+        constexpr const ValueT& value() const&
+        {
+            this->check_value();
+            return this->m_storage->get();
+        }
+
+        constexpr ValueT&& value() &&
+        {
+            this->check_value();
+            return this->m_storage->get();
+        }
+
+        constexpr const ValueT&& value() const&&
+        {
+            this->check_value();
+            return this->m_storage->get();
+        }
+
+}; // End of Result Class
+
+} // End of tmns::outcome namespace
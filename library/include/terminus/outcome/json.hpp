@@ -0,0 +1,204 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    json.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/error_domain.hpp>
+#include <terminus/outcome/result.hpp>
+#include <terminus/outcome/wire.hpp>
+
+namespace tmns::outcome {
+
+namespace impl {
+
+/**
+ * @brief Append `value` as a JSON string.  Runs of characters that need no escaping are appended
+ *        in one piece.
+ */
+inline void write_json_string( std::string& out, std::string_view value )
+{
+    static constexpr char cHex[] = "0123456789abcdef";
+    out += '"';
+    std::size_t run = 0;
+    for( std::size_t i = 0; i < value.size(); ++i )
+    {
+        const auto ch = static_cast<unsigned char>( value[i] );
+        if( ch >= 0x20 && ch != '"' && ch != '\\' )
+        {
+            continue;
+        }
+        out.append( value.data() + run, i - run );
+        run = i + 1;
+        switch( ch )
+        {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n";  break;
+            case '\r': out += "\\r";  break;
+            case '\t': out += "\\t";  break;
+            default:
+                out += "\\u00";
+                out += cHex[ch >> 4];
+                out += cHex[ch & 0xF];
+                break;
+        }
+    }
+    out.append( value.data() + run, value.size() - run );
+    out += '"';
+}
+
+/**
+ * @brief Append a number with `std::to_chars`.
+ */
+template <class ValueT>
+void write_json_number( std::string& out, ValueT value )
+{
+    std::array<char,32> buffer;
+    const auto [end, ec] = std::to_chars( buffer.data(), buffer.data() + buffer.size(), value );
+    out.append( buffer.data(), end );
+}
+
+/**
+ * @brief Append a value of a `Result`.  Non-finite numbers, which JSON cannot represent, are
+ *        written as `null`.
+ */
+template <class ValueT>
+void write_json_value( std::string& out, const ValueT& value )
+{
+    if constexpr ( std::same_as<ValueT,bool> )
+    {
+        out += value ? "true" : "false";
+    }
+    else if constexpr ( std::integral<ValueT> )
+    {
+        write_json_number( out, value );
+    }
+    else if constexpr ( std::floating_point<ValueT> )
+    {
+        if( std::isfinite( value ) )
+        {
+            write_json_number( out, value );
+        }
+        else
+        {
+            out += "null";
+        }
+    }
+    else if constexpr ( std::convertible_to<const ValueT&, std::string_view> )
+    {
+        write_json_string( out, value );
+    }
+    else
+    {
+        static_assert( std::is_void_v<ValueT> && !std::is_void_v<ValueT>,
+                       "write_json supports results of booleans, numbers, strings and void" );
+    }
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Append `error` as one JSON object to `out`.
+ *
+ * The object has the category name and wire id, the code, the enumerator name for error
+ * domains, the code's message, the details, and the file and line of the `fail()` call when
+ * known:
+ *
+ * @code
+ * {"category":"Error","category_id":966928374,"code":18,"name":"NOT_FOUND","message":"NOT_FOUND","details":"tile 7","file":"tiles.cpp","line":88}
+ * @endcode
+ *
+ * Appending to a buffer that is reused across calls makes the writer allocation free once the
+ * buffer has grown; add a newline after each record to ship newline-delimited JSON.
+ */
+template <class ErrorCodeT>
+void write_json( std::string& out, const Error<ErrorCodeT>& error )
+{
+    const auto code = error.code();
+    out += "{\"category\":";
+    impl::write_json_string( out, code.category().name() );
+    out += ",\"category_id\":";
+    impl::write_json_number( out, wire_category_id<ErrorCodeT>() );
+    out += ",\"code\":";
+    impl::write_json_number( out, code.value() );
+    if constexpr ( impl::Has_Name_Table<ErrorCodeT> )
+    {
+        if( const auto name = error_code_name( static_cast<ErrorCodeT>( code.value() ) ); !name.empty() )
+        {
+            out += ",\"name\":";
+            impl::write_json_string( out, name );
+        }
+    }
+    out += ",\"message\":";
+    if constexpr ( impl::Has_Message_View<ErrorCodeT> )
+    {
+        impl::write_json_string( out, error.code_message() );
+    }
+    else
+    {
+        impl::write_json_string( out, code.message() );
+    }
+    out += ",\"details\":";
+    impl::write_json_string( out, error.details() );
+    if( const auto where = error.origin(); where.line() != 0 )
+    {
+        out += ",\"file\":";
+        impl::write_json_string( out, where.file_name() );
+        out += ",\"line\":";
+        impl::write_json_number( out, where.line() );
+    }
+    out += '}';
+}
+
+/**
+ * @brief Append `result` as one JSON object to `out`: `{"ok":true,"value":...}`, `{"ok":true}`
+ *        for `Result<void>`, or `{"ok":false,"error":{...}}`.
+ */
+template <class ValueT, class ErrorCodeT>
+void write_json( std::string& out, const Result<ValueT,ErrorCodeT>& result )
+{
+    if( result.has_value() )
+    {
+        if constexpr ( std::is_void_v<ValueT> )
+        {
+            out += "{\"ok\":true}";
+        }
+        else
+        {
+            out += "{\"ok\":true,\"value\":";
+            impl::write_json_value( out, result.assume_value() );
+            out += '}';
+        }
+    }
+    else
+    {
+        out += "{\"ok\":false,\"error\":";
+        write_json( out, result.assume_error() );
+        out += '}';
+    }
+}
+
+} // End of tmns::outcome namespace
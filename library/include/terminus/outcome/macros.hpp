@@ -15,6 +15,7 @@
 #pragma once
 
 // C++ Includes
+#include <source_location>
 #include <system_error>
 #include <type_traits>
 
@@ -37,6 +38,20 @@
 */
 #define __TERMINUS_OUTCOME_IMPL_RES_VAR __TERMINUS_OUTCOME_IMPL_CONCAT(__result, __LINE__)
 
+/**
+ * Helper macro that records the current line as a propagation site of the error held by a
+ * failed result.  Expands to nothing unless `TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES` is
+ * defined.
+ *
+ * @see Error::propagation_sites
+*/
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+    #define __TERMINUS_OUTCOME_IMPL_RECORD_SITE(result) \
+        (result).assume_error().add_propagation_site( std::source_location::current() );
+#else
+    #define __TERMINUS_OUTCOME_IMPL_RECORD_SITE(result)
+#endif
+
 /**
  * Helper macro that enabled C-style macro overloading.  The macro expands into a macro called
  * `NAME` based on the number of parameters supplied to the macro invoking this one.
@@ -57,6 +72,7 @@
     auto __TERMINUS_OUTCOME_IMPL_RES_VAR = expression;                   \
     if(__TERMINUS_OUTCOME_IMPL_RES_VAR.has_error())                      \
     {                                                                    \
+        __TERMINUS_OUTCOME_IMPL_RECORD_SITE(__TERMINUS_OUTCOME_IMPL_RES_VAR) \
         return std::move(__TERMINUS_OUTCOME_IMPL_RES_VAR).as_failure() ; \
     }
 
@@ -117,12 +133,19 @@
  *       as those types and take advantage of argument-dependent-lookup (ADL) to properly find the
  *       definition.
  *
+ * Besides the standard `make_error_code()` overload, this also declares `outcome_error_category()`,
+ * which lets `Error<ErrorCodeT>` find the concrete category type at compile time and use its
+ * non-virtual `message_view()` lookup.
+ *
  * @param ErrorCategoryT the error category type (should be derived type provided by the user).
  * @param ErrorCodeT    The type of the enum class that contains the set of error code variants.
 */
 #define TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY( ErrorCategoryT, ErrorCodeT ) \
     inline std::error_code make_error_code( ErrorCodeT e ) {    \
         return {static_cast<int>(e), ErrorCategoryT::get() };   \
+    }                                                           \
+    constexpr const ErrorCategoryT& outcome_error_category( ErrorCodeT ) noexcept { \
+        return ErrorCategoryT::get();                           \
     }
 
 /**
@@ -0,0 +1,355 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    multi_error.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/impl/cache_line.hpp>
+#include <terminus/outcome/result.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Bounded collection of the errors of a batch job.
+ *
+ * Keeps the first `limit` errors in full, and counts every error by code, so validating a large
+ * catalog reports each failure without storing thousands of copies of the same message.  Errors
+ * past the limit only add to the counts and to `dropped()`.
+ *
+ * `as_result()` folds the collection into one `Error` with a summary, so a validation pass can
+ * end with `TERMINUS_OUTCOME_TRY( errors.as_result() );`.
+ *
+ * Not thread safe; parallel collectors share a `Multi_Error_Collector` instead.
+ */
+template <class ErrorCodeT>
+class Multi_Error
+{
+    public:
+
+        using error_type = Error<ErrorCodeT>;
+
+        /**
+         * Number of errors recorded with one code.
+         */
+        struct Code_Count
+        {
+            ErrorCodeT  code;
+            std::size_t count;
+        };
+
+        /// Errors kept in full by default
+        static constexpr std::size_t cDefault_Limit = 16;
+
+        /**
+         * @brief Constructor.
+         *
+         * @param limit Number of errors kept in full.
+         */
+        explicit Multi_Error( std::size_t limit = cDefault_Limit )
+          : m_limit{ limit }
+        {}
+
+        /**
+         * @brief Record an error.
+         */
+        void add( error_type error )
+        {
+            count_code( static_cast<ErrorCodeT>( error.code().value() ), 1 );
+            if( m_errors.size() < m_limit )
+            {
+                m_errors.push_back( std::move( error ) );
+            }
+            else
+            {
+                ++m_dropped;
+            }
+        }
+
+        /**
+         * @brief Record the error of `result`, if it failed.
+         *
+         * @returns True if `result` succeeded.
+         */
+        template <class ValueT>
+        bool add( const Result<ValueT,ErrorCodeT>& result )
+        {
+            if( result.has_error() )
+            {
+                add( result.assume_error() );
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Add the errors and counts of `other`.  Its full errors are kept while there is
+         *        room, after the ones already here.
+         */
+        void merge( const Multi_Error& other )
+        {
+            for( const auto& c : other.m_counts )
+            {
+                count_code( c.code, c.count );
+            }
+            const auto room = m_limit - std::min( m_limit, m_errors.size() );
+            const auto take = std::min( room, other.m_errors.size() );
+            m_errors.insert( m_errors.end(), other.m_errors.begin(), other.m_errors.begin() + take );
+            m_dropped += other.m_dropped + ( other.m_errors.size() - take );
+        }
+
+        /**
+         * @brief Check whether any error was recorded.
+         */
+        bool has_error() const noexcept
+        {
+            return !m_errors.empty() || m_dropped != 0;
+        }
+
+        /**
+         * @brief Number of errors recorded.
+         */
+        std::size_t total() const noexcept
+        {
+            return m_errors.size() + m_dropped;
+        }
+
+        /**
+         * @brief Number of errors only counted, not kept in full.
+         */
+        std::size_t dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+        /**
+         * @brief Number of errors kept in full at most.
+         */
+        std::size_t limit() const noexcept
+        {
+            return m_limit;
+        }
+
+        /**
+         * @brief The errors kept in full, in the order they were recorded.
+         */
+        std::span<const error_type> errors() const noexcept
+        {
+            return m_errors;
+        }
+
+        /**
+         * @brief Number of errors recorded per code, in the order the codes were first seen.
+         */
+        std::span<const Code_Count> counts() const noexcept
+        {
+            return m_counts;
+        }
+
+        /**
+         * @brief Number of errors recorded with `code`.
+         */
+        std::size_t count( ErrorCodeT code ) const noexcept
+        {
+            auto it = std::ranges::find( m_counts, code, &Code_Count::code );
+            return it == m_counts.end() ? 0 : it->count;
+        }
+
+        /**
+         * @brief Fold the collection into one error.
+         *
+         * With a single error, that error is returned as is.  Otherwise the result has the code of
+         * the first error, and details listing the number of errors per code, the number dropped,
+         * and the message of each error kept in full.
+         *
+         * @note Must only be called if `has_error()`.
+         */
+        error_type to_error() const
+        {
+            if( total() == 1 && !m_errors.empty() )
+            {
+                return m_errors.front();
+            }
+
+            std::string summary = std::to_string( total() ) + " errors (";
+            for( std::size_t i = 0; i < m_counts.size(); ++i )
+            {
+                summary += ( i == 0 ? "" : ", " ) + std::error_code( m_counts[i].code ).message() +
+                           " x" + std::to_string( m_counts[i].count );
+            }
+            summary += ")";
+            if( m_dropped != 0 )
+            {
+                summary += ", " + std::to_string( m_dropped ) + " not kept";
+            }
+            for( const auto& e : m_errors )
+            {
+                summary += "; ";
+                summary += e.message();
+            }
+
+            const auto code = m_errors.empty() ? m_counts.front().code
+                                               : static_cast<ErrorCodeT>( m_errors.front().code().value() );
+            return error_type( code, summary );
+        }
+
+        /**
+         * @brief Success if no error was recorded, otherwise the error from `to_error()`.
+         */
+        Result<void,ErrorCodeT> as_result() const
+        {
+            if( !has_error() )
+            {
+                return impl::success();
+            }
+            return impl::failure( to_error() );
+        }
+
+    private:
+
+        void count_code( ErrorCodeT code, std::size_t n )
+        {
+            auto it = std::ranges::find( m_counts, code, &Code_Count::code );
+            if( it == m_counts.end() )
+            {
+                m_counts.push_back( Code_Count{ code, n } );
+            }
+            else
+            {
+                it->count += n;
+            }
+        }
+
+        /// Number of errors kept in full at most
+        std::size_t m_limit;
+
+        /// Errors kept in full
+        std::vector<error_type> m_errors;
+
+        /// Errors recorded per code
+        std::vector<Code_Count> m_counts;
+
+        /// Errors past the limit
+        std::size_t m_dropped{ 0 };
+
+}; // End of Multi_Error Class
+
+/**
+ * `Multi_Error` shared by parallel workers.
+ *
+ * Holds one `Multi_Error` per shard, each on its own cache line with its own lock, and maps
+ * each thread to a shard by its id.  With at least as many shards as workers the locks are
+ * rarely contended.  `take()` merges the shards once the workers are done.
+ */
+template <class ErrorCodeT>
+class Multi_Error_Collector
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param limit  Number of errors kept in full, per shard and when merged.
+         * @param shards Number of shards, at least one.
+         */
+        explicit Multi_Error_Collector( std::size_t limit  = Multi_Error<ErrorCodeT>::cDefault_Limit,
+                                        std::size_t shards = std::thread::hardware_concurrency() )
+          : m_limit{ limit },
+            m_shards( std::max<std::size_t>( shards, 1 ) )
+        {
+            for( auto& shard : m_shards )
+            {
+                shard.errors = Multi_Error<ErrorCodeT>{ limit };
+            }
+        }
+
+        /**
+         * @brief Record an error from any thread.
+         */
+        void add( Error<ErrorCodeT> error )
+        {
+            auto& shard = local_shard();
+            std::lock_guard lock{ shard.mutex };
+            shard.errors.add( std::move( error ) );
+        }
+
+        /**
+         * @brief Record the error of `result` from any thread, if it failed.
+         *
+         * @returns True if `result` succeeded.
+         */
+        template <class ValueT>
+        bool add( const Result<ValueT,ErrorCodeT>& result )
+        {
+            if( result.has_error() )
+            {
+                add( result.assume_error() );
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Merge the shards into one `Multi_Error` and reset them.  Call once the workers
+         *        are done.
+         */
+        Multi_Error<ErrorCodeT> take()
+        {
+            Multi_Error<ErrorCodeT> merged{ m_limit };
+            for( auto& shard : m_shards )
+            {
+                std::lock_guard lock{ shard.mutex };
+                merged.merge( shard.errors );
+                shard.errors = Multi_Error<ErrorCodeT>{ m_limit };
+            }
+            return merged;
+        }
+
+    private:
+
+        /**
+         * Errors recorded by the threads mapped to one shard.
+         */
+        struct alignas( impl::cCache_Line_Size ) Shard
+        {
+            std::mutex              mutex;
+            Multi_Error<ErrorCodeT> errors;
+        };
+
+        Shard& local_shard() noexcept
+        {
+            return m_shards[std::hash<std::thread::id>{}( std::this_thread::get_id() ) % m_shards.size()];
+        }
+
+        /// Number of errors kept in full
+        std::size_t m_limit;
+
+        /// One collection per shard
+        std::vector<Shard> m_shards;
+
+}; // End of Multi_Error_Collector Class
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,136 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    panic.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Handler for unrecoverable errors in builds without exceptions.
+ *
+ * When `TERMINUS_OUTCOME_NO_EXCEPTIONS` is defined, which it is automatically when the compiler
+ * has exceptions disabled, everything that would throw calls the panic handler instead:
+ * `panic()`, `value()` on a failed `Result`, `error()` on a successful one, and `value()` on an
+ * empty `Optional`.  Otherwise the handler is never called.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <source_location>
+#include <string_view>
+#include <system_error>
+
+#if !defined( TERMINUS_OUTCOME_NO_EXCEPTIONS ) && !defined( __cpp_exceptions )
+    #define TERMINUS_OUTCOME_NO_EXCEPTIONS
+#endif
+
+namespace tmns::outcome {
+
+/**
+ * What went wrong, passed to the panic handler.  The views are only valid during the call.
+ */
+struct Panic_Info
+{
+    /// Error code, or `std::errc::invalid_argument` for misuse such as reading an empty optional
+    std::error_code code;
+
+    /// Details of the error, or a description of the misuse
+    std::string_view details;
+
+    /// Where the error was created, if known
+    std::source_location where;
+};
+
+/**
+ * Handler for unrecoverable errors.  It must not return: log, flush, and then abort, exit or
+ * jump to a recovery point.  If it does return, `std::abort()` is called.
+ */
+using Panic_Handler = void (*)( const Panic_Info& info );
+
+namespace impl {
+
+/**
+ * @brief Write the error to `stderr` and abort.
+ */
+[[noreturn]] inline void default_panic_handler( const Panic_Info& info ) noexcept
+{
+    std::fprintf( stderr, "%s:%u: panic: %s %d: %.*s\n",
+                  info.where.line() != 0 ? info.where.file_name() : "<unknown>",
+                  static_cast<unsigned>( info.where.line() ),
+                  info.code.category().name(),
+                  info.code.value(),
+                  static_cast<int>( info.details.size() ),
+                  info.details.data() );
+    std::fflush( stderr );
+    std::abort();
+}
+
+/**
+ * @brief The installed handler.
+ */
+inline std::atomic<Panic_Handler>& panic_handler() noexcept
+{
+    static constinit std::atomic<Panic_Handler> handler{ &default_panic_handler };
+    return handler;
+}
+
+/**
+ * @brief Call the installed handler, and abort if it returns.
+ */
+[[noreturn]] inline void raise_panic( const std::error_code&     code,
+                                      std::string_view           details,
+                                      const std::source_location& where = {} ) noexcept
+{
+    panic_handler().load( std::memory_order_acquire )( Panic_Info{ code, details, where } );
+    std::abort();
+}
+
+/**
+ * @brief Call the installed handler for misuse that would have thrown `error`.
+ */
+[[noreturn]] inline void raise_panic( const std::exception& error ) noexcept
+{
+    raise_panic( std::make_error_code( std::errc::invalid_argument ), error.what() );
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Install the handler called in place of throwing when `TERMINUS_OUTCOME_NO_EXCEPTIONS` is
+ *        defined.  Null restores the default, which writes the error to `stderr` and aborts.
+ *
+ * @returns The previous handler.
+ */
+inline Panic_Handler set_panic_handler( Panic_Handler handler ) noexcept
+{
+    return impl::panic_handler().exchange( handler != nullptr ? handler : &impl::default_panic_handler,
+                                           std::memory_order_acq_rel );
+}
+
+} // End of tmns::outcome namespace
+
+/**
+ * Define `boost::throw_exception()` to call the panic handler.  Boost requires programs built
+ * without exceptions to define it, and `value()` on an empty `boost::optional` calls it.  Use
+ * once, at global scope, in one source file of a program that uses the Boost backend without
+ * exceptions.
+ */
+#define TERMINUS_OUTCOME_DEFINE_BOOST_THROW_EXCEPTION()                                           \
+    namespace boost {                                                                             \
+        [[noreturn]] void throw_exception( const std::exception& e ) {                            \
+            ::tmns::outcome::impl::raise_panic( e );                                              \
+        }                                                                                         \
+        [[noreturn]] void throw_exception( const std::exception& e, const source_location& ) {    \
+            ::tmns::outcome::impl::raise_panic( e );                                              \
+        }                                                                                         \
+    }
@@ -15,152 +15,29 @@
 #pragma once
 
 // C++ Standard Libraries
-#include <future>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <string_view>
 #include <system_error>
 #include <type_traits>
 #include <utility>
 
-// Boost Libraries
-#include <boost/outcome/result.hpp>
-#include <boost/outcome/utils.hpp>
-
 // Terminus Libraries
 #include <terminus/outcome/error.hpp>
+#include <terminus/outcome/impl/error_observer.hpp>
 
-// Namespace alias for the boost outcome namespace
-namespace tmns::outcome::impl {
-    namespace outcome = BOOST_OUTCOME_V2_NAMESPACE;
-} // end of tmns::outcome::impl namespace
+#if defined( TERMINUS_OUTCOME_USE_STD_BACKEND )
+    #include <terminus/outcome/impl/result_std.hpp>
+#else
+    #include <terminus/outcome/impl/result_boost.hpp>
+#endif
 
 namespace tmns::outcome {
 
-/**
- * Contains the result of an operation that could potentially fail, offering an alternative to
- * error handling as opposed to exceptions.
- *
- * The type is built on top of Boost.Outcome `basic_result` type.  Its API is identical to
- * that type with one additional enhancement: our `Result` type supports references.
- *
- * This result type fits into the standard library's `std::error_code` error handling framework
- * by using the `Error` type as the failure outcome type for the result.
- *
- * @see https://www.boost.org/doc/libs/1_81_0/libs/outcome/doc/html/index.html
-*/
-template <class ValueT, class ErrorCodeT>
-class Result;
-
-/**
- * Specialization of the `Result` type for non-reference types.  This is basically just a
- * pass-through to the underlying Boost `result` type.
-*/
-template <typename  ValueT, typename ErrorCodeT>
-  requires( !std::is_lvalue_reference_v<ValueT> )
-class Result<ValueT,ErrorCodeT> : public impl::outcome::result<ValueT,Error<ErrorCodeT>>
-{
-    public:
-        using impl::outcome::result<ValueT, Error<ErrorCodeT>>::result;
-}; // End of Result Class
-
-/**
- * Specialization of the `Result` type for reference types.  This effectively wraps the non-ref
- * type of `ValueT` inside of a std::reference_wrapper` and then overloads a few of the public
- * Boost.Outcome `result` methods to hide the fact that the value is stored inside a wrapper type.
- *
- * Note that we don't have to account for the case when `ValueT` is `void` because we can't do
- * anything with a `void&` type anyways.
-*/
-template <class ValueT, class ErrorCodeT> requires ( std::is_lvalue_reference_v<ValueT> )
-class Result<ValueT,ErrorCodeT>
-     : public impl::outcome::result<std::reference_wrapper<std::remove_reference_t<ValueT>>,
-                                    Error<ErrorCodeT>>
-{
-    private:
-
-        using BASE_TYPE = impl::outcome::result<std::reference_wrapper<std::remove_reference_t<ValueT>>,
-                                                Error<ErrorCodeT>>;
-
-    public:
-
-        // Expose the inherited constructors
-        using impl::outcome::result<std::reference_wrapper<std::remove_reference_t<ValueT>>,
-                                    Error<ErrorCodeT>>::result;
-
-        /**
-         * Override the base methods for accessing the value so that we can get the value inside the
-         * reference wrapper without making the user call `get()` all over the place.
-        */
-        ValueT& assume_value() &
-        {
-            return BASE_TYPE::assume_value().get();
-        }
-
-        const ValueT& assume_value() const&
-        {
-            return BASE_TYPE::assume_value().get();
-        }
-
-        ValueT&& assume_value() &&
-        {
-            return BASE_TYPE::assume_value().get();
-        }
-
-        const ValueT&& assume_value() const&&
-        {
-            return BASE_TYPE::value().get();
-        }
-
-        ValueT& value() &
-        {
-            return BASE_TYPE::value().get();
-        }
-
-        const ValueT& value() const&
-        {
-            return BASE_TYPE::value().get();
-        }
-
-        ValueT&& value() &&
-        {
-            return BASE_TYPE::value().get();
-        }
-
-        const ValueT&& value() const&&
-        {
-            return BASE_TYPE::value().get();
-        }
-
-}; // End of Result Class
-
-
-/**
- * A result wrapped inside of a future object.
- *
- * Futures are used in asynchronous operations.  In other contexts, when an asynchronous
- * operation fails, an exception is usually set so that attempting to access the future value
- * results in a throw.  Using the semantics of this library however, calling `get()` on a
- * `FutureResult` should never result in an exception being thrown.  Instead, the caller should
- * immediately check the return value of `get()` to inspect whether or not the result contains a
- * success value or a failure value.
-*/
-template <class ValueT, class ErrorCodeT>
-using FutureResult = std::future<Result<ValueT,ErrorCodeT>>;
-
-/**
- * Overload that tells the Boost Outcome library how to transform our custom error with a payload
- * into a `std::system_error` and throw it.  The library needs this in order to successfully use our
- * custom error type.
- *
- * @note Calling this function will always throw an exception.
- *
- * @param e The error containing information used to construct a system error and throw it.
-*/
-template <class ErrorCodeT>
-inline void outcome_throw_as_system_error_with_payload( Error<ErrorCodeT> e )
-{
-    impl::outcome::try_throw_std_exception_from_error( e.code() );
-    throw std::system_error( e.code(), e.details() );
-}
-
 /**
  * Utility function that creates a successful outcome result by constructing the type in place,
  * forwarding the provided arguments onto the underlying success type's constructor.
@@ -170,10 +47,10 @@ inline void outcome_throw_as_system_error_with_payload( Error<ErrorCodeT> e )
  * @return A newly constructed result type in the success state.
 */
 template <class ValueT, class... ArgsT>
-auto ok( ArgsT&&... args )
+constexpr auto ok( ArgsT&&... args )
 {
     ValueT v( std::forward<ArgsT>( args )... );
-    return impl::outcome::success( std::move( v ) );
+    return impl::success( std::move( v ) );
 }
 
 /**
@@ -181,17 +58,66 @@ auto ok( ArgsT&&... args )
  *
  * @return A newly constructed result type in the success state.
 */
-inline auto ok()
+constexpr auto ok()
 {
-    return impl::outcome::success();
+    return impl::success();
 }
 
+namespace impl {
+
+/**
+ * Maps the decayed arguments of `fail()` to the `Error` type they construct.
+ */
+template <class HeadT, class... ArgsT>
+struct Fail_Error;
+
+/// `fail( code, args... )`
+template <class ErrorCodeT, class... ArgsT>
+  requires std::is_error_code_enum_v<ErrorCodeT>
+struct Fail_Error<ErrorCodeT, ArgsT...>
+{
+    using type = Error<ErrorCodeT>;
+};
+
+/// `fail( cDeferred, code, args... )`
+template <class ErrorCodeT, class... ArgsT>
+struct Fail_Error<Deferred, ErrorCodeT, ArgsT...> : Fail_Error<ErrorCodeT, ArgsT...> {};
+
+/// `fail( std::allocator_arg, alloc, ... )`
+template <class AllocT, class... ArgsT>
+struct Fail_Error<std::allocator_arg_t, AllocT, ArgsT...> : Fail_Error<ArgsT...> {};
+
+/// `fail( error )`
+template <class ErrorCodeT>
+struct Fail_Error<Error<ErrorCodeT>>
+{
+    using type = Error<ErrorCodeT>;
+};
+
+template <class HeadT, class... ArgsT>
+using Fail_Error_T = typename Fail_Error<std::remove_cvref_t<HeadT>, std::remove_cvref_t<ArgsT>...>::type;
+
+} // End of impl namespace
+
 /**
- * Utility function that helps create a failure outcome result by constructing the failure type
+ * Utility that helps create a failure outcome result by constructing the failure type
  * in-place, forwarding the provided arguments onto the underlying failure type's constructor.
  *
  * In this case, our failure type is always `Error`, so we don't need an additional template
- * parameter to indicate what failure type to construct.
+ * parameter to indicate what failure type to construct.  The arguments take one of these forms,
+ * matching the `Error` constructors:
+ *
+ * - `fail( code, args... )`
+ * - `fail( cDeferred, code, args... )`
+ * - `fail( std::allocator_arg, alloc, code, args... )`
+ * - `fail( std::allocator_arg, alloc, cDeferred, code, args... )`
+ * - `fail( error )`, which copies or moves a previous error.  This is especially useful when using
+ *   the `Error::append()` function to add information to the error message as it propogates back
+ *   up the call stack.
+ *
+ * Except for the last form, the `std::source_location` of the call is passed to the error
+ * observer and, when `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined, stored in the error
+ * for `Error::origin()`.  Capturing it costs a pointer copy, with no formatting or allocation.
  *
  * @note  This does not actually construct the result type.  Instead, it constructs a tagged failure
  * type that is used by the `Result` constructor to create a result in the failure state.  This is
@@ -200,48 +126,175 @@ inline auto ok()
  * confusing because it would require specifying a type that doesn't have anything to do with
  * the error being constructed.
  *
- * @param args The arguments to forward to the failure type's constructor.
- *
- * @returns A tagged type used to construct a result in the failure state.
+ * @note  `fail` is a class template rather than a function so that the source location can be a
+ * defaulted parameter after the variadic arguments; the deduction guide below stands in for
+ * template argument deduction.  It derives from the backend's failure type, so `Result`
+ * converts from it exactly as it did from `failure()`.
 */
-template <class ErrorCodeT, class... ArgsT>
-auto fail( ErrorCodeT c, ArgsT&&... args )
+template <class HeadT, class... ArgsT>
+class fail : public impl::Failure_Type<impl::Fail_Error_T<HeadT,ArgsT...>>
 {
-    return impl::outcome::failure( Error<ErrorCodeT>{ c, std::forward<ArgsT>( args )...} );
-}
+    private:
+
+        using ERROR_TYPE = impl::Fail_Error_T<HeadT,ArgsT...>;
+        using BASE_TYPE  = impl::Failure_Type<ERROR_TYPE>;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param head  The error code, a tag, or a previous error.
+         * @param args  The remaining arguments to forward to the failure type's constructor.
+         * @param where Location of the call.  Leave this defaulted.
+         */
+        fail( HeadT&& head, ArgsT&&... args, const std::source_location& where = std::source_location::current() )
+          : BASE_TYPE{ make_error( where, std::forward<HeadT>( head ), std::forward<ArgsT>( args )... ) }
+        {}
+
+    private:
+
+        static ERROR_TYPE make_error( const std::source_location& where, HeadT&& head, ArgsT&&... args )
+        {
+            if constexpr ( std::is_same_v<std::remove_cvref_t<HeadT>, ERROR_TYPE> )
+            {
+                // Errors passed along keep their original location, and were already observed
+                return ERROR_TYPE{ std::forward<HeadT>( head ) };
+            }
+            else
+            {
+                ERROR_TYPE error{ where, std::forward<HeadT>( head ), std::forward<ArgsT>( args )... };
+                impl::notify_error_observer( error, where, Error_Event::Kind::FAIL );
+                return error;
+            }
+        }
+
+}; // End of fail Class
 
 /**
- * Utility function that helps create a failure result from a copy or move of a previous error.
- * This is especially useful when using the `Error::append()` function to add information to the
- * error message as it propogates back up the call stack.
- *
- * @param e The original `Error` instance.
+ * Deduction guide that gives `fail( ... )` the forwarding behavior of a function template.
+ */
+template <class HeadT, class... ArgsT>
+fail( HeadT&&, ArgsT&&... ) -> fail<HeadT,ArgsT...>;
+
+namespace impl {
+
+/**
+ * Error code passed to `panic()`.
  *
- * @returns A tagged type used to construct a result in the failure state.
-*/
-template <class ErrorT>
-auto fail( ErrorT&& e )
+ * The code converts to this type at the call site, so the defaulted `std::source_location`
+ * records where `panic()` was called while `panic()` stays a `[[noreturn]]` function.  A class
+ * template like `fail` would parse `panic( code );` as a declaration.
+ */
+class Panic_Code
 {
-    return impl::outcome::failure( std::forward<ErrorT>( e ) );
-}
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param code  The error code.
+         * @param where Location of the `panic()` call.  Leave this defaulted.
+         */
+        template <class ErrorCodeT>
+          requires std::is_error_code_enum_v<ErrorCodeT>
+        Panic_Code( ErrorCodeT code, const std::source_location& where = std::source_location::current() ) noexcept
+          : m_code{ static_cast<int>( code ) },
+            m_where{ where },
+            m_raise{ &raise_as<ErrorCodeT> }
+        {}
+
+        /**
+         * @brief Build the error with `details`, report it and throw it, or call the panic
+         *        handler when `TERMINUS_OUTCOME_NO_EXCEPTIONS` is defined.
+         */
+        [[noreturn]] void raise( std::string_view details ) const
+        {
+            m_raise( m_code, details, m_where );
+            std::abort();
+        }
+
+    private:
+
+        template <class ErrorCodeT>
+        static void raise_as( int code, std::string_view details, const std::source_location& where )
+        {
+            Error<ErrorCodeT> e( where, static_cast<ErrorCodeT>( code ), details );
+            notify_error_observer( e, where, Error_Event::Kind::PANIC );
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+            raise_panic( e.code(), e.details(), where );
+#else
+            outcome_throw_as_system_error_with_payload( std::move( e ) );
+#endif
+        }
+
+        /// Integer representation of the error code
+        int m_code;
+
+        /// Location of the `panic()` call
+        std::source_location m_where;
+
+        /// Builds and raises the error for the original code type
+        void ( *m_raise )( int, std::string_view, const std::source_location& );
+
+}; // End of Panic_Code Class
+
+} // End of impl namespace
 
 /**
  * Utility function that constructs a new Error and throws it as a `std::system_error`.
  *
  * Use this function to indicate behavior that should result in the termination of the program.
  * Rather than call `std::abort()` or a similar function here, we throw an exceeption so that the
- * program can unwind the stack and deallocate memory where needed.
+ * program can unwind the stack and deallocate memory where needed.  When
+ * `TERMINUS_OUTCOME_NO_EXCEPTIONS` is defined, the panic handler is called instead; see
+ * `set_panic_handler()`.
  *
  * This utility function is provided in addition to the no-value policies provided by the Boost
  * Outcome library.
  *
+ * The observer and the panic handler receive the location of the call, and so does the error
+ * when `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined.
+ *
+ * @param code The error code.
  * @param args The arguments used ot construct an instance of `Error`.
 */
-template <class ErrorCodeT, class... ArgsT>
-void panic( ErrorCodeT c, ArgsT&&... args )
+template <class... ArgsT>
+[[noreturn]] void panic( impl::Panic_Code code, ArgsT&&... args )
+{
+    if constexpr ( sizeof...(ArgsT) == 0 )
+    {
+        code.raise( {} );
+    }
+    else
+    {
+        impl::Pmr_Ostringstream sout{ std::ios_base::out, error_memory_resource() };
+        ( sout << ... << std::forward<ArgsT>( args ) );
+        code.raise( std::move( sout ).str() );
+    }
+}
+
+/**
+ * Output stream operator for results.  Writes the value, "ok" for `Result<void>`, or "error: "
+ * followed by the error, straight to the stream.
+ */
+template <class ValueT, class ErrorCodeT>
+  requires ( std::is_void_v<ValueT> ||
+             requires( std::ostream& s, const std::remove_reference_t<ValueT>& v ) { s << v; } )
+std::ostream& operator << ( std::ostream& s, const Result<ValueT,ErrorCodeT>& result )
 {
-    Error e( c, std::forward<ArgsT>( args )... );
-    outcome_throw_as_system_error_with_payload( std::move( e ) );
+    if( result.has_error() )
+    {
+        return s << "error: " << result.assume_error();
+    }
+    if constexpr ( std::is_void_v<ValueT> )
+    {
+        return s << "ok";
+    }
+    else
+    {
+        return s << static_cast<const std::remove_reference_t<ValueT>&>( result.assume_value() );
+    }
 }
 
 } // End of tmns::outcome namespace
\ No newline at end of file
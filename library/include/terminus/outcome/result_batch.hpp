@@ -0,0 +1,404 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    result_batch.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/optional.hpp>
+#include <terminus/outcome/result.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Outcomes of a large number of elements, stored by column.
+ *
+ * A `std::vector<Result<T,E>>` pays for an `Error` and a discriminant in every element.  This
+ * stores the values in one dense array, whether each element succeeded in a bitmap, and the
+ * errors of the failed elements in a side table sorted by index.  For a raster of `float`s that
+ * is a little over four bytes per element while failures are rare.
+ *
+ * The bulk queries work on 64 elements of the bitmap at a time, and `values()` hands the dense
+ * array to numeric kernels without a copy.  The value at a failed position is value-initialized;
+ * kernels that must ignore it can consult `success_mask()`.
+ *
+ * A new element succeeds with a value-initialized value.  The batch is not thread safe: workers
+ * filling it in parallel should write their values through `values()` and record failures
+ * afterwards, or fill one batch each.
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_Batch
+{
+    static_assert( std::default_initializable<ValueT> && !std::is_reference_v<ValueT>,
+                   "Result_Batch stores values in a dense array and needs default-constructible values" );
+
+    public:
+
+        using value_type = ValueT;
+        using error_type = Error<ErrorCodeT>;
+
+        /**
+         * Entry of the error side table.
+         */
+        struct Error_Entry
+        {
+            std::size_t index;
+            error_type  error;
+        };
+
+        /// Elements per word of the success bitmap
+        static constexpr std::size_t cWord_Bits = 64;
+
+        /**
+         * @brief Constructor.
+         *
+         * @param count Number of elements, all successful with value-initialized values.
+         */
+        explicit Result_Batch( std::size_t count = 0 )
+        {
+            resize( count );
+        }
+
+        /**
+         * @brief Number of elements.
+         */
+        std::size_t size() const noexcept
+        {
+            return m_values.size();
+        }
+
+        /**
+         * @brief Check whether there are no elements.
+         */
+        bool empty() const noexcept
+        {
+            return m_values.empty();
+        }
+
+        /**
+         * @brief Change the number of elements.  New elements succeed with value-initialized
+         *        values, and the errors of removed elements are dropped.
+         */
+        void resize( std::size_t count )
+        {
+            const auto old_size = size();
+            m_values.resize( count );
+            m_success.resize( ( count + cWord_Bits - 1 ) / cWord_Bits, 0 );
+            if( count > old_size )
+            {
+                for( auto i = old_size; i < count && i % cWord_Bits != 0; ++i )
+                {
+                    set_bit( i );
+                }
+                for( auto w = ( old_size + cWord_Bits - 1 ) / cWord_Bits; w < m_success.size(); ++w )
+                {
+                    m_success[w] = ~std::uint64_t{ 0 };
+                }
+            }
+            else
+            {
+                std::erase_if( m_errors, [count]( const Error_Entry& e ) { return e.index >= count; } );
+            }
+            clear_tail();
+        }
+
+        /**
+         * @brief Reserve storage for `count` elements.
+         */
+        void reserve( std::size_t count )
+        {
+            m_values.reserve( count );
+            m_success.reserve( ( count + cWord_Bits - 1 ) / cWord_Bits );
+        }
+
+        /**
+         * @brief Append the outcome of one element.
+         */
+        void push_back( Result<ValueT,ErrorCodeT> result )
+        {
+            const auto index = size();
+            resize( index + 1 );
+            if( result.has_value() )
+            {
+                m_values[index] = std::move( result ).assume_value();
+            }
+            else
+            {
+                set_error( index, std::move( result ).assume_error() );
+            }
+        }
+
+        /**
+         * @brief Mark element `index` successful with `value`.
+         */
+        void set_value( std::size_t index, ValueT value )
+        {
+            assert( index < size() );
+            m_values[index] = std::move( value );
+            if( !has_value( index ) )
+            {
+                set_bit( index );
+                m_errors.erase( find_error( index ) );
+            }
+        }
+
+        /**
+         * @brief Mark element `index` failed with `error`.
+         */
+        void set_error( std::size_t index, error_type error )
+        {
+            assert( index < size() );
+            m_values[index] = ValueT{};
+            if( has_value( index ) )
+            {
+                m_success[index / cWord_Bits] &= ~bit( index );
+                // Failures are usually recorded in index order, which appends
+                auto pos = m_errors.empty() || m_errors.back().index < index ? m_errors.end()
+                                                                            : find_error( index );
+                m_errors.insert( pos, Error_Entry{ index, std::move( error ) } );
+            }
+            else
+            {
+                find_error( index )->error = std::move( error );
+            }
+        }
+
+        /**
+         * @brief Check whether element `index` succeeded.
+         */
+        bool has_value( std::size_t index ) const noexcept
+        {
+            assert( index < size() );
+            return ( m_success[index / cWord_Bits] & bit( index ) ) != 0;
+        }
+
+        /**
+         * @brief Check whether element `index` failed.
+         */
+        bool has_error( std::size_t index ) const noexcept
+        {
+            return !has_value( index );
+        }
+
+        /**
+         * @brief Value of element `index`, which must have succeeded.
+         */
+        ValueT& value( std::size_t index ) noexcept
+        {
+            assert( has_value( index ) );
+            return m_values[index];
+        }
+
+        /**
+         * @brief Value of element `index`, which must have succeeded.
+         */
+        const ValueT& value( std::size_t index ) const noexcept
+        {
+            assert( has_value( index ) );
+            return m_values[index];
+        }
+
+        /**
+         * @brief Error of element `index`, which must have failed.
+         */
+        const error_type& error( std::size_t index ) const noexcept
+        {
+            assert( has_error( index ) );
+            return find_error( index )->error;
+        }
+
+        /**
+         * @brief Outcome of element `index`, copied into a `Result`.
+         */
+        Result<ValueT,ErrorCodeT> result( std::size_t index ) const
+        {
+            if( has_value( index ) )
+            {
+                return impl::success( m_values[index] );
+            }
+            return impl::failure( error( index ) );
+        }
+
+        /**
+         * @brief The dense array of values.  Failed positions hold value-initialized values.
+         */
+        std::span<ValueT> values() noexcept
+        {
+            return m_values;
+        }
+
+        /**
+         * @brief The dense array of values.  Failed positions hold value-initialized values.
+         */
+        std::span<const ValueT> values() const noexcept
+        {
+            return m_values;
+        }
+
+        /**
+         * @brief The success bitmap: bit `i % 64` of word `i / 64` is set if element `i`
+         *        succeeded.  Bits past `size()` are clear.
+         */
+        std::span<const std::uint64_t> success_mask() const noexcept
+        {
+            return m_success;
+        }
+
+        /**
+         * @brief The errors of the failed elements, sorted by index.
+         */
+        std::span<const Error_Entry> errors() const noexcept
+        {
+            return m_errors;
+        }
+
+        /**
+         * @brief Number of failed elements, counted from the bitmap.
+         */
+        std::size_t count_errors() const noexcept
+        {
+            std::size_t successes = 0;
+            for( auto word : m_success )
+            {
+                successes += static_cast<std::size_t>( std::popcount( word ) );
+            }
+            return size() - successes;
+        }
+
+        /**
+         * @brief Index of the first failed element, if any.
+         */
+        Optional<std::size_t> first_error() const noexcept
+        {
+            for( std::size_t w = 0; w < m_success.size(); ++w )
+            {
+                const auto failed = ~m_success[w] & word_mask( w );
+                if( failed != 0 )
+                {
+                    return w * cWord_Bits + static_cast<std::size_t>( std::countr_zero( failed ) );
+                }
+            }
+            return {};
+        }
+
+        /**
+         * @brief Copy the values of the successful elements, in order, to the front of `out`.
+         *
+         * Words of the bitmap with every element successful are copied as one block of 64
+         * values; the others are walked bit by bit.
+         *
+         * @param out Destination, with room for `size() - count_errors()` values.
+         *
+         * @returns Number of values copied.
+         */
+        std::size_t compact_values( std::span<ValueT> out ) const
+        {
+            std::size_t count = 0;
+            for( std::size_t w = 0; w < m_success.size(); ++w )
+            {
+                const auto base = w * cWord_Bits;
+                auto word = m_success[w];
+                if( word == ~std::uint64_t{ 0 } )
+                {
+                    assert( count + cWord_Bits <= out.size() );
+                    std::copy_n( m_values.begin() + base, cWord_Bits, out.begin() + count );
+                    count += cWord_Bits;
+                    continue;
+                }
+                while( word != 0 )
+                {
+                    assert( count < out.size() );
+                    out[count++] = m_values[base + static_cast<std::size_t>( std::countr_zero( word ) )];
+                    word &= word - 1;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Values of the successful elements, in order.
+         */
+        std::vector<ValueT> compact_values() const
+        {
+            std::vector<ValueT> out( size() - count_errors() );
+            compact_values( out );
+            return out;
+        }
+
+    private:
+
+        static constexpr std::uint64_t bit( std::size_t index ) noexcept
+        {
+            return std::uint64_t{ 1 } << ( index % cWord_Bits );
+        }
+
+        void set_bit( std::size_t index ) noexcept
+        {
+            m_success[index / cWord_Bits] |= bit( index );
+        }
+
+        /**
+         * @brief Bits of word `w` that hold elements.
+         */
+        std::uint64_t word_mask( std::size_t w ) const noexcept
+        {
+            const auto used = size() - w * cWord_Bits;
+            return used >= cWord_Bits ? ~std::uint64_t{ 0 } : ( std::uint64_t{ 1 } << used ) - 1;
+        }
+
+        /**
+         * @brief Clear the bits past the last element, so whole-word queries can ignore them.
+         */
+        void clear_tail() noexcept
+        {
+            if( !m_success.empty() )
+            {
+                m_success.back() &= word_mask( m_success.size() - 1 );
+            }
+        }
+
+        auto find_error( std::size_t index ) const noexcept
+        {
+            return std::ranges::lower_bound( m_errors, index, {}, &Error_Entry::index );
+        }
+
+        auto find_error( std::size_t index ) noexcept
+        {
+            return std::ranges::lower_bound( m_errors, index, {}, &Error_Entry::index );
+        }
+
+        /// Values, dense
+        std::vector<ValueT> m_values;
+
+        /// One bit per element, set if it succeeded
+        std::vector<std::uint64_t> m_success;
+
+        /// Errors of the failed elements, sorted by index
+        std::vector<Error_Entry> m_errors;
+
+}; // End of Result_Batch Class
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,951 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    result_future.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/optional.hpp>
+#include <terminus/outcome/result.hpp>
+
+namespace tmns::outcome {
+
+template <class ValueT, class ErrorCodeT>
+class Result_Promise;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Future;
+
+template <class ValueT, class ErrorCodeT>
+class Result_Slot;
+
+namespace impl {
+
+/**
+ * Gives the library's combinators and awaiters access to `Result_Future::attach()`.
+ */
+struct Future_Access
+{
+    /**
+     * @brief Hand the result of `future` to `fn` once it is stored, consuming the future.  `fn`
+     *        runs on the thread storing the result, or before this returns if it is stored.
+     */
+    template <class FutureT, class FuncT>
+    static void attach( FutureT&& future, FuncT&& fn )
+    {
+        std::move( future ).attach( std::forward<FuncT>( fn ) );
+    }
+};
+
+/**
+ * @brief Code stored when a promise is destroyed without a result.
+ *
+ * Error code enumerations choose it by declaring `outcome_broken_promise_code( ErrorCodeT )`
+ * next to the enumeration, where argument-dependent lookup finds it.  Without one, the
+ * value-initialized code is used.
+ */
+template <class ErrorCodeT>
+ErrorCodeT broken_promise_code() noexcept
+{
+    if constexpr ( requires { { outcome_broken_promise_code( ErrorCodeT{} ) } -> std::same_as<ErrorCodeT>; } )
+    {
+        return outcome_broken_promise_code( ErrorCodeT{} );
+    }
+    else
+    {
+        return ErrorCodeT{};
+    }
+}
+
+/**
+ * Detects `Result` types returned by continuations, which are forwarded rather than wrapped.
+ */
+template <class T>
+struct Result_Traits
+{
+    static constexpr bool is_result = false;
+};
+
+template <class ValueT, class ErrorCodeT>
+struct Result_Traits<Result<ValueT,ErrorCodeT>>
+{
+    static constexpr bool is_result = true;
+    using value_type      = ValueT;
+    using error_code_type = ErrorCodeT;
+};
+
+/**
+ * Value type of the future returned by `then()`: the value of a returned `Result`, otherwise the
+ * returned type itself.
+ */
+template <class FuncT, class... ArgsT>
+struct Then_Value
+{
+    using RETURN_TYPE = std::invoke_result_t<FuncT&, ArgsT...>;
+    using type        = std::remove_cvref_t<RETURN_TYPE>;
+};
+
+template <class FuncT, class... ArgsT>
+  requires Result_Traits<std::remove_cvref_t<std::invoke_result_t<FuncT&, ArgsT...>>>::is_result
+struct Then_Value<FuncT, ArgsT...>
+{
+    using type = typename Result_Traits<std::remove_cvref_t<std::invoke_result_t<FuncT&, ArgsT...>>>::value_type;
+};
+
+/**
+ * @brief Store the outcome of `fn( args... )` in `promise`.
+ */
+template <class ValueT, class ErrorCodeT, class FuncT, class... ArgsT>
+void fulfill_with( Result_Promise<ValueT,ErrorCodeT>& promise, FuncT& fn, ArgsT&&... args )
+{
+    using RETURN_TYPE = std::invoke_result_t<FuncT&, ArgsT...>;
+    if constexpr ( Result_Traits<std::remove_cvref_t<RETURN_TYPE>>::is_result )
+    {
+        promise.set_result( std::invoke( fn, std::forward<ArgsT>( args )... ) );
+    }
+    else if constexpr ( std::is_void_v<RETURN_TYPE> )
+    {
+        std::invoke( fn, std::forward<ArgsT>( args )... );
+        promise.set_value();
+    }
+    else
+    {
+        promise.set_value( std::invoke( fn, std::forward<ArgsT>( args )... ) );
+    }
+}
+
+/**
+ * Executor that runs continuations on the thread completing the future.
+ */
+struct Inline_Executor {};
+
+/**
+ * Move-only task, used to check that an executor accepts the tasks continuations post.
+ */
+struct Executor_Probe
+{
+    Executor_Probe( Executor_Probe&& ) = default;
+    Executor_Probe( const Executor_Probe& ) = delete;
+    void operator()() {}
+};
+
+} // End of impl namespace
+
+/**
+ * Executors that `Result_Future` continuations can be posted to.  `execute()` receives a
+ * move-only callable taking no arguments, so it must be a template or take a
+ * `std::move_only_function<void()>`.
+ */
+template <class ExecutorT>
+concept Result_Executor = requires( ExecutorT& executor, impl::Executor_Probe task )
+{
+    executor.execute( std::move( task ) );
+};
+
+namespace impl {
+
+/**
+ * Callback run with the result of a `Result_Future` once it is stored.  Allocated from the
+ * state's memory resource and destroyed by `run()`.
+ */
+template <class ResultT>
+class Continuation
+{
+    public:
+
+        /**
+         * @brief Invoke the callback with the result, then destroy and free the continuation.
+         */
+        virtual void run( ResultT&& result ) noexcept = 0;
+
+    protected:
+
+        ~Continuation() = default;
+
+}; // End of Continuation Class
+
+template <class ResultT, class FuncT>
+class Continuation_Impl final : public Continuation<ResultT>
+{
+    public:
+
+        Continuation_Impl( std::pmr::memory_resource* resource, FuncT&& fn )
+          : m_resource{ resource },
+            m_fn{ std::move( fn ) }
+        {}
+
+        static Continuation<ResultT>* create( std::pmr::memory_resource* resource, FuncT&& fn )
+        {
+            void* p = resource->allocate( sizeof( Continuation_Impl ), alignof( Continuation_Impl ) );
+            return ::new( p ) Continuation_Impl( resource, std::move( fn ) );
+        }
+
+        void run( ResultT&& result ) noexcept override
+        {
+            m_fn( std::move( result ) );
+            auto* resource = m_resource;
+            this->~Continuation_Impl();
+            resource->deallocate( this, sizeof( Continuation_Impl ), alignof( Continuation_Impl ) );
+        }
+
+    private:
+
+        /// Resource the continuation was allocated from
+        std::pmr::memory_resource* m_resource;
+
+        /// Callback
+        FuncT m_fn;
+
+}; // End of Continuation_Impl Class
+
+/**
+ * Shared state between a `Result_Promise` and its `Result_Future`.
+ *
+ * Readiness is a single atomic word.  The consumer marks it as waiting before blocking on it
+ * with `std::atomic::wait()`, which is a futex on Linux, and the producer only issues the wake-up
+ * when it sees that mark.  There is no mutex, condition variable or `std::exception_ptr`.
+ *
+ * Instead of waiting, the consumer can attach a continuation and mark the word as continued.
+ * Whichever side comes second, the producer storing the result or the consumer attaching the
+ * continuation, runs it.
+ *
+ * States allocated from a memory resource are reference counted by the promise and the future.
+ * States owned by a `Result_Slot` have no resource and live as long as the slot.
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_State
+{
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+
+        /**
+         * @brief Constructor.
+         *
+         * @param resource Resource the state was allocated from, or null when it is owned by a slot.
+         */
+        explicit Result_State( std::pmr::memory_resource* resource ) noexcept
+          : m_resource{ resource }
+        {}
+
+        Result_State( const Result_State& ) = delete;
+        Result_State& operator = ( const Result_State& ) = delete;
+
+        /**
+         * @brief Destructor.  Destroys the result, if one was stored.
+         */
+        ~Result_State()
+        {
+            if( is_ready() )
+            {
+                result().~RESULT_TYPE();
+            }
+        }
+
+        /**
+         * @brief Allocate a state from a memory resource, owned by one reference.
+         */
+        static Result_State* create( std::pmr::memory_resource* resource )
+        {
+            void* p = resource->allocate( sizeof( Result_State ), alignof( Result_State ) );
+            return ::new( p ) Result_State( resource );
+        }
+
+        /**
+         * @brief Add a reference.
+         */
+        void acquire() noexcept
+        {
+            m_refs.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Drop a reference, freeing the state with the last one.
+         */
+        void release() noexcept
+        {
+            if( m_resource != nullptr && m_refs.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+            {
+                auto* resource = m_resource;
+                this->~Result_State();
+                resource->deallocate( this, sizeof( Result_State ), alignof( Result_State ) );
+            }
+        }
+
+        /**
+         * @brief Construct the result and wake the consumer if it is waiting.
+         */
+        template <class... ArgsT>
+        void emplace( ArgsT&&... args )
+        {
+            ::new( static_cast<void*>( m_storage ) ) RESULT_TYPE( std::forward<ArgsT>( args )... );
+            const auto previous = m_flag.exchange( cReady, std::memory_order_acq_rel );
+            if( previous == cWaiting )
+            {
+                m_flag.notify_all();
+            }
+            else if( previous == cContinued )
+            {
+                run_continuation();
+            }
+        }
+
+        /**
+         * @brief Attach the continuation receiving the result, in place of the future.
+         *
+         * Takes over the future's reference, which is dropped once the continuation has run.  If
+         * the result is already stored, the continuation runs before this returns.
+         */
+        template <class FuncT>
+        void set_continuation( FuncT&& fn )
+        {
+            m_continuation = Continuation_Impl<RESULT_TYPE,std::decay_t<FuncT>>::create( resource(),
+                                                                                          std::forward<FuncT>( fn ) );
+            auto flag = cEmpty;
+            if( !m_flag.compare_exchange_strong( flag, cContinued, std::memory_order_acq_rel ) )
+            {
+                run_continuation();
+            }
+        }
+
+        /**
+         * @brief Resource for allocations tied to this state.
+         */
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            return m_resource != nullptr ? m_resource : std::pmr::get_default_resource();
+        }
+
+        /**
+         * @brief Check whether the result has been stored.
+         */
+        bool is_ready() const noexcept
+        {
+            return m_flag.load( std::memory_order_acquire ) == cReady;
+        }
+
+        /**
+         * @brief Block until the result has been stored.
+         */
+        void wait() noexcept
+        {
+            auto flag = cEmpty;
+            if( !m_flag.compare_exchange_strong( flag, cWaiting, std::memory_order_acquire ) &&
+                flag == cReady )
+            {
+                return;
+            }
+            do
+            {
+                m_flag.wait( cWaiting, std::memory_order_acquire );
+            } while( m_flag.load( std::memory_order_acquire ) != cReady );
+        }
+
+        /**
+         * @brief Access the stored result.  Only valid once `is_ready()` is true.
+         */
+        RESULT_TYPE& result() noexcept
+        {
+            return *std::launder( reinterpret_cast<RESULT_TYPE*>( m_storage ) );
+        }
+
+    private:
+
+        void run_continuation() noexcept
+        {
+            std::exchange( m_continuation, nullptr )->run( std::move( result() ) );
+            release();
+        }
+
+        /// No result and no waiter
+        static constexpr std::uint32_t cEmpty = 0;
+
+        /// No result and the consumer is blocked
+        static constexpr std::uint32_t cWaiting = 1;
+
+        /// Result stored
+        static constexpr std::uint32_t cReady = 2;
+
+        /// No result and a continuation is attached
+        static constexpr std::uint32_t cContinued = 3;
+
+        /// Readiness word the consumer waits on
+        std::atomic<std::uint32_t> m_flag{ cEmpty };
+
+        /// Number of promises and futures referring to the state
+        std::atomic<std::uint32_t> m_refs{ 1 };
+
+        /// Resource the state came from, or null when it is owned by a slot
+        std::pmr::memory_resource* m_resource;
+
+        /// Continuation attached in place of the future
+        Continuation<RESULT_TYPE>* m_continuation{ nullptr };
+
+        /// Storage for the result
+        alignas( RESULT_TYPE ) unsigned char m_storage[sizeof( RESULT_TYPE )];
+
+}; // End of Result_State Class
+
+} // End of impl namespace
+
+/**
+ * Producer side of a single-shot, non-throwing channel for one `Result`.
+ *
+ * This replaces `std::promise<Result<...>>`.  A `Result` already carries its error, so the
+ * standard future's exception transport, mutex and condition variable are dead weight.  The shared
+ * state here holds the result next to one atomic readiness word.
+ *
+ * The state is allocated from a `std::pmr::memory_resource`, so a pool resource can serve high
+ * task rates without touching the global heap.  A `Result_Slot` keeps the state inline instead,
+ * for callers that can guarantee it outlives the task.
+ *
+ * If the promise is destroyed without a result, it stores an error with the code returned by
+ * `outcome_broken_promise_code()`, so the future never waits forever.
+ *
+ * @code
+ * std::pmr::synchronized_pool_resource pool;
+ * Result_Promise<int,Error_Code> promise{ &pool };
+ * auto future = promise.get_future();
+ * submit( [p = std::move( promise )]() mutable { p.set_value( 42 ); } );
+ * auto result = future.get();
+ * @endcode
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_Promise
+{
+    private:
+
+        using STATE_TYPE = impl::Result_State<ValueT,ErrorCodeT>;
+
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+        using FUTURE_TYPE = Result_Future<ValueT,ErrorCodeT>;
+
+        /**
+         * @brief Constructor.
+         *
+         * @param resource Memory resource to allocate the shared state from.
+         */
+        explicit Result_Promise( std::pmr::memory_resource* resource = std::pmr::get_default_resource() )
+          : m_state{ STATE_TYPE::create( resource ) }
+        {}
+
+        Result_Promise( const Result_Promise& ) = delete;
+        Result_Promise& operator = ( const Result_Promise& ) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        Result_Promise( Result_Promise&& rhs ) noexcept
+          : m_state{ std::exchange( rhs.m_state, nullptr ) },
+            m_satisfied{ rhs.m_satisfied },
+            m_retrieved{ rhs.m_retrieved }
+        {}
+
+        /**
+         * @brief Move assignment.  Breaks the promise currently held, if it has no result yet.
+         */
+        Result_Promise& operator = ( Result_Promise&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                abandon();
+                m_state     = std::exchange( rhs.m_state, nullptr );
+                m_satisfied = rhs.m_satisfied;
+                m_retrieved = rhs.m_retrieved;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor.  Breaks the promise if it has no result yet.
+         */
+        ~Result_Promise()
+        {
+            abandon();
+        }
+
+        /**
+         * @brief Get the future that receives the result.  May only be called once.
+         */
+        FUTURE_TYPE get_future() noexcept
+        {
+            assert( m_state != nullptr && !m_retrieved );
+            m_retrieved = true;
+            m_state->acquire();
+            return FUTURE_TYPE{ m_state };
+        }
+
+        /**
+         * @brief Store the result.
+         */
+        void set_result( RESULT_TYPE result )
+        {
+            store( std::move( result ) );
+        }
+
+        /**
+         * @brief Store a success value, constructed in place from `args`.
+         */
+        template <class... ArgsT>
+          requires ( !std::is_void_v<ValueT> && !std::is_lvalue_reference_v<ValueT> )
+        void set_value( ArgsT&&... args )
+        {
+            store( std::in_place_type<ValueT>, std::forward<ArgsT>( args )... );
+        }
+
+        /**
+         * @brief Store a success value referring to `value`.
+         */
+        template <class RefT>
+          requires ( std::is_lvalue_reference_v<ValueT> && std::convertible_to<RefT&, ValueT> )
+        void set_value( RefT& value )
+        {
+            store( impl::success( std::ref( value ) ) );
+        }
+
+        /**
+         * @brief Store success for a `void` result.
+         */
+        void set_value() requires std::is_void_v<ValueT>
+        {
+            store( ok() );
+        }
+
+        /**
+         * @brief Store an error.
+         */
+        void set_error( Error<ErrorCodeT> error )
+        {
+            store( impl::failure( std::move( error ) ) );
+        }
+
+    private:
+
+        friend class Result_Slot<ValueT,ErrorCodeT>;
+
+        /**
+         * @brief Constructor for a state owned by a slot.
+         */
+        explicit Result_Promise( STATE_TYPE* state ) noexcept
+          : m_state{ state }
+        {}
+
+        template <class... ArgsT>
+        void store( ArgsT&&... args )
+        {
+            assert( m_state != nullptr && !m_satisfied );
+            m_state->emplace( std::forward<ArgsT>( args )... );
+            m_satisfied = true;
+        }
+
+        void abandon() noexcept
+        {
+            if( m_state == nullptr )
+            {
+                return;
+            }
+            if( !m_satisfied && m_retrieved )
+            {
+                m_state->emplace( impl::failure( Error<ErrorCodeT>( impl::broken_promise_code<ErrorCodeT>() ) ) );
+            }
+            std::exchange( m_state, nullptr )->release();
+        }
+
+        /// Shared state, or null once moved from
+        STATE_TYPE* m_state{ nullptr };
+
+        /// True once a result was stored
+        bool m_satisfied{ false };
+
+        /// True once the future was handed out
+        bool m_retrieved{ false };
+
+}; // End of Result_Promise Class
+
+/**
+ * Consumer side of a `Result_Promise`.
+ *
+ * None of the member functions throw on their own account: an abandoned promise shows up as an
+ * error in the result.  Like `std::future`, `get()` consumes the future.
+ *
+ * Instead of blocking, `then()`, `on_error()` and `finally()` attach continuations and return the
+ * future of the next step, so one thread can drive many operations in flight:
+ *
+ * @code
+ * read_tile_async( id )
+ *     .then( []( Tile t ) { return decode( t ); } )          // skipped if the read failed
+ *     .on_error( []( const Error<Error_Code>& e ) { log( e ); } )
+ *     .finally( [&] { --in_flight; } );
+ * @endcode
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_Future
+{
+    private:
+
+        using STATE_TYPE = impl::Result_State<ValueT,ErrorCodeT>;
+
+    public:
+
+        using RESULT_TYPE = Result<ValueT,ErrorCodeT>;
+
+        /**
+         * @brief Construct a future with no shared state.
+         */
+        Result_Future() noexcept = default;
+
+        Result_Future( const Result_Future& ) = delete;
+        Result_Future& operator = ( const Result_Future& ) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        Result_Future( Result_Future&& rhs ) noexcept
+          : m_state{ std::exchange( rhs.m_state, nullptr ) }
+        {}
+
+        /**
+         * @brief Move assignment.
+         */
+        Result_Future& operator = ( Result_Future&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                reset();
+                m_state = std::exchange( rhs.m_state, nullptr );
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~Result_Future()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Check whether the future refers to a shared state.
+         */
+        bool valid() const noexcept
+        {
+            return m_state != nullptr;
+        }
+
+        /**
+         * @brief Check whether the result is available without blocking.
+         */
+        bool is_ready() const noexcept
+        {
+            assert( valid() );
+            return m_state->is_ready();
+        }
+
+        /**
+         * @brief Block until the result is available.
+         */
+        void wait() const noexcept
+        {
+            assert( valid() );
+            m_state->wait();
+        }
+
+        /**
+         * @brief Block until the result is available and take it.  The future is no longer
+         *        valid afterwards.
+         */
+        RESULT_TYPE get() noexcept( std::is_nothrow_move_constructible_v<RESULT_TYPE> )
+        {
+            wait();
+            RESULT_TYPE result{ std::move( m_state->result() ) };
+            reset();
+            return result;
+        }
+
+        /**
+         * @brief Take the result if it is available, without blocking.
+         *
+         * @returns The result, after which the future is no longer valid, or an empty optional.
+         */
+        Optional<RESULT_TYPE> try_get() noexcept( std::is_nothrow_move_constructible_v<RESULT_TYPE> )
+        {
+            if( !is_ready() )
+            {
+                return cEmpty;
+            }
+            return get();
+        }
+
+        /**
+         * @brief Chain a continuation that runs on success, without blocking.
+         *
+         * `fn` receives the value (nothing for `Result<void>`) and returns a value, `void`, or a
+         * `Result<U,ErrorCodeT>`.  The returned future receives its outcome.  On failure `fn` is
+         * skipped and the error goes straight to the returned future, so it short-circuits the
+         * rest of the chain.
+         *
+         * The continuation runs on the thread storing the result, or on the calling thread if the
+         * result is already stored.  It must not throw.  This future is consumed.
+         */
+        template <class FuncT>
+        auto then( FuncT&& fn ) &&
+        {
+            return std::move( *this ).then_on( static_cast<impl::Inline_Executor*>( nullptr ),
+                                               std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Chain a continuation that runs on success, posted to `executor`.
+         *
+         * @note The executor must outlive the chain.
+         */
+        template <Result_Executor ExecutorT, class FuncT>
+        auto then( ExecutorT& executor, FuncT&& fn ) &&
+        {
+            return std::move( *this ).then_on( &executor, std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Chain a continuation that runs on failure, without blocking.
+         *
+         * `fn` receives the `Error`.  It can return `void`, which passes the error on, or a
+         * value or `Result<ValueT,ErrorCodeT>` to recover with.  Success skips `fn`.
+         */
+        template <class FuncT>
+        Result_Future on_error( FuncT&& fn ) &&
+        {
+            return std::move( *this ).on_error_on( static_cast<impl::Inline_Executor*>( nullptr ),
+                                                   std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Chain a continuation that runs on failure, posted to `executor`.
+         */
+        template <Result_Executor ExecutorT, class FuncT>
+        Result_Future on_error( ExecutorT& executor, FuncT&& fn ) &&
+        {
+            return std::move( *this ).on_error_on( &executor, std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Chain a continuation that runs either way, without blocking.  `fn` takes no
+         *        arguments and the result passes through unchanged.
+         */
+        template <class FuncT>
+        Result_Future finally( FuncT&& fn ) &&
+        {
+            return std::move( *this ).finally_on( static_cast<impl::Inline_Executor*>( nullptr ),
+                                                  std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Chain a continuation that runs either way, posted to `executor`.
+         */
+        template <Result_Executor ExecutorT, class FuncT>
+        Result_Future finally( ExecutorT& executor, FuncT&& fn ) &&
+        {
+            return std::move( *this ).finally_on( &executor, std::forward<FuncT>( fn ) );
+        }
+
+    private:
+
+        friend class Result_Promise<ValueT,ErrorCodeT>;
+
+        template <class OtherValueT, class OtherErrorCodeT>
+        friend class Result_Future;
+
+        friend struct impl::Future_Access;
+
+        explicit Result_Future( STATE_TYPE* state ) noexcept
+          : m_state{ state }
+        {}
+
+        template <class ExecutorT, class FuncT>
+        auto then_on( ExecutorT* executor, FuncT&& fn )
+        {
+            using NEXT_VALUE_TYPE = typename std::conditional_t<std::is_void_v<ValueT>,
+                                                                impl::Then_Value<std::decay_t<FuncT>>,
+                                                                impl::Then_Value<std::decay_t<FuncT>,ValueT>>::type;
+            using NEXT_PROMISE_TYPE = Result_Promise<NEXT_VALUE_TYPE,ErrorCodeT>;
+
+            return chain<NEXT_VALUE_TYPE>( executor,
+                [fn = std::forward<FuncT>( fn )]( RESULT_TYPE&& r, NEXT_PROMISE_TYPE& next ) mutable
+                {
+                    if( r.has_error() )
+                    {
+                        next.set_error( std::move( r ).assume_error() );
+                    }
+                    else if constexpr ( std::is_void_v<ValueT> )
+                    {
+                        impl::fulfill_with( next, fn );
+                    }
+                    else
+                    {
+                        impl::fulfill_with( next, fn, std::move( r ).assume_value() );
+                    }
+                } );
+        }
+
+        template <class ExecutorT, class FuncT>
+        Result_Future on_error_on( ExecutorT* executor, FuncT&& fn )
+        {
+            return chain<ValueT>( executor,
+                [fn = std::forward<FuncT>( fn )]( RESULT_TYPE&& r, Result_Promise<ValueT,ErrorCodeT>& next ) mutable
+                {
+                    using RETURN_TYPE = std::invoke_result_t<std::decay_t<FuncT>&, Error<ErrorCodeT>&>;
+                    if( r.has_value() )
+                    {
+                        next.set_result( std::move( r ) );
+                    }
+                    else if constexpr ( std::is_void_v<RETURN_TYPE> )
+                    {
+                        std::invoke( fn, r.assume_error() );
+                        next.set_result( std::move( r ) );
+                    }
+                    else
+                    {
+                        impl::fulfill_with( next, fn, r.assume_error() );
+                    }
+                } );
+        }
+
+        template <class ExecutorT, class FuncT>
+        Result_Future finally_on( ExecutorT* executor, FuncT&& fn )
+        {
+            return chain<ValueT>( executor,
+                [fn = std::forward<FuncT>( fn )]( RESULT_TYPE&& r, Result_Promise<ValueT,ErrorCodeT>& next ) mutable
+                {
+                    std::invoke( fn );
+                    next.set_result( std::move( r ) );
+                } );
+        }
+
+        /**
+         * @brief Attach `step`, which turns this future's result into the next one, run inline or
+         *        posted to `executor`.
+         */
+        template <class NextValueT, class ExecutorT, class StepT>
+        Result_Future<NextValueT,ErrorCodeT> chain( [[maybe_unused]] ExecutorT* executor, StepT&& step )
+        {
+            assert( valid() );
+            Result_Promise<NextValueT,ErrorCodeT> next{ m_state->resource() };
+            auto future = next.get_future();
+
+            if constexpr ( std::is_same_v<ExecutorT, impl::Inline_Executor> )
+            {
+                attach( [step = std::forward<StepT>( step ), next = std::move( next )]( RESULT_TYPE&& r ) mutable
+                        {
+                            step( std::move( r ), next );
+                        } );
+            }
+            else
+            {
+                attach( [executor, step = std::forward<StepT>( step ), next = std::move( next )]( RESULT_TYPE&& r ) mutable
+                        {
+                            executor->execute(
+                                [step = std::move( step ), next = std::move( next ), r = std::move( r )]() mutable
+                                {
+                                    step( std::move( r ), next );
+                                } );
+                        } );
+            }
+            return future;
+        }
+
+        /**
+         * @brief Hand the result to `fn` once it is stored, consuming this future.
+         */
+        template <class FuncT>
+        void attach( FuncT&& fn )
+        {
+            assert( valid() );
+            // The continuation takes over this future's reference
+            std::exchange( m_state, nullptr )->set_continuation( std::forward<FuncT>( fn ) );
+        }
+
+        void reset() noexcept
+        {
+            if( m_state != nullptr )
+            {
+                std::exchange( m_state, nullptr )->release();
+            }
+        }
+
+        /// Shared state, or null when not valid
+        STATE_TYPE* m_state{ nullptr };
+
+}; // End of Result_Future Class
+
+/**
+ * Shared state with automatic storage, for a promise and future that must not allocate.
+ *
+ * The slot must outlive both the promise and the future it hands out, and can be used once.
+ *
+ * @code
+ * Result_Slot<int,Error_Code> slot;
+ * auto promise = slot.get_promise();
+ * auto future  = promise.get_future();
+ * @endcode
+ */
+template <class ValueT, class ErrorCodeT>
+class Result_Slot
+{
+    public:
+
+        using PROMISE_TYPE = Result_Promise<ValueT,ErrorCodeT>;
+
+        Result_Slot() noexcept = default;
+
+        Result_Slot( const Result_Slot& ) = delete;
+        Result_Slot& operator = ( const Result_Slot& ) = delete;
+
+        /**
+         * @brief Get the promise writing into this slot.  May only be called once.
+         */
+        PROMISE_TYPE get_promise() noexcept
+        {
+            return PROMISE_TYPE{ &m_state };
+        }
+
+    private:
+
+        /// Inline shared state
+        impl::Result_State<ValueT,ErrorCodeT> m_state{ nullptr };
+
+}; // End of Result_Slot Class
+
+/**
+ * A result delivered asynchronously.
+ *
+ * Calling `get()` on a `FutureResult` never throws.  Check the returned `Result` for success or
+ * failure instead.
+*/
+template <class ValueT, class ErrorCodeT>
+using FutureResult = Result_Future<ValueT,ErrorCodeT>;
+
+} // End of tmns::outcome namespace
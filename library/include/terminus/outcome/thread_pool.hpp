@@ -0,0 +1,324 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    thread_pool.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/impl/cache_line.hpp>
+#include <terminus/outcome/result.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+namespace tmns::outcome {
+
+/**
+ * Work-stealing thread pool running jobs that produce a `Result`.
+ *
+ * Each worker owns a deque.  Work posted from a worker goes to that worker's deque, and the
+ * worker takes it back newest first, so continuations and nested jobs stay on the thread whose
+ * cache holds their data.  Work posted from other threads goes to a shared queue and is taken in
+ * submission order.  A worker with neither steals the oldest job from another worker's deque.
+ * Idle workers sleep on one atomic word that every post bumps.
+ *
+ * `submit()` returns a `Result_Future` for the job's `Result`, and the pool is a
+ * `Result_Executor`, so continuations can be posted back to it:
+ *
+ * @code
+ * Thread_Pool pool;
+ * auto tile = pool.submit( [=] { return load_tile( id ); } )
+ *                 .then( pool, []( Tile t ) { return decode( t ); } );
+ * @endcode
+ *
+ * Jobs must not throw.  Jobs still queued when the pool is destroyed are run before it returns.
+ */
+class Thread_Pool
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * If starting a worker fails, the workers already started are stopped and joined before
+         * the exception propagates.
+         *
+         * @param threads  Number of workers, at least one.
+         * @param resource Memory resource for the shared state of submitted jobs.
+         */
+        explicit Thread_Pool( std::size_t                threads  = std::thread::hardware_concurrency(),
+                              std::pmr::memory_resource* resource = std::pmr::get_default_resource() )
+          : m_queues( std::max<std::size_t>( threads, 1 ) ),
+            m_resource{ resource }
+        {
+            m_threads.reserve( m_queues.size() );
+#if defined( __cpp_exceptions )
+            try
+            {
+#endif
+                for( std::size_t i = 0; i < m_queues.size(); ++i )
+                {
+                    m_threads.emplace_back( [this, i] { run( i ); } );
+                }
+#if defined( __cpp_exceptions )
+            }
+            catch( ... )
+            {
+                // The destructor does not run when the constructor throws
+                stop();
+                throw;
+            }
+#endif
+        }
+
+        Thread_Pool( const Thread_Pool& ) = delete;
+        Thread_Pool& operator = ( const Thread_Pool& ) = delete;
+
+        /**
+         * @brief Destructor.  Runs the queued jobs, then joins the workers.
+         */
+        ~Thread_Pool()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Number of workers.
+         */
+        std::size_t size() const noexcept
+        {
+            return m_queues.size();
+        }
+
+        /**
+         * @brief Post a job that takes no arguments and returns nothing.
+         */
+        template <class FuncT>
+        void execute( FuncT&& job )
+        {
+            auto& queue = t_current.pool == this ? m_queues[t_current.index] : m_shared;
+            {
+                std::lock_guard lock{ queue.mutex };
+                queue.jobs.emplace_back( std::forward<FuncT>( job ) );
+            }
+            wake( false );
+        }
+
+        /**
+         * @brief Run `fn`, which returns a `Result`, on the pool.
+         *
+         * @returns The future receiving the result of `fn`.
+         */
+        template <class FuncT>
+          requires impl::Result_Traits<std::remove_cvref_t<std::invoke_result_t<std::decay_t<FuncT>&>>>::is_result
+        auto submit( FuncT&& fn )
+        {
+            return submit( std::stop_token{}, std::forward<FuncT>( fn ) );
+        }
+
+        /**
+         * @brief Run `fn` on the pool unless `stop` is requested before it starts.
+         *
+         * A job skipped this way completes with the code returned by
+         * `outcome_broken_promise_code()`, like any abandoned promise.
+         */
+        template <class FuncT>
+          requires impl::Result_Traits<std::remove_cvref_t<std::invoke_result_t<std::decay_t<FuncT>&>>>::is_result
+        auto submit( std::stop_token stop, FuncT&& fn )
+        {
+            using TRAITS_TYPE = impl::Result_Traits<std::remove_cvref_t<std::invoke_result_t<std::decay_t<FuncT>&>>>;
+            using PROMISE_TYPE = Result_Promise<typename TRAITS_TYPE::value_type,
+                                                typename TRAITS_TYPE::error_code_type>;
+
+            PROMISE_TYPE promise{ m_resource };
+            auto future = promise.get_future();
+            execute( [stop = std::move( stop ), fn = std::forward<FuncT>( fn ), promise = std::move( promise )]() mutable
+            {
+                if( !stop.stop_requested() )
+                {
+                    promise.set_result( std::invoke( fn ) );
+                }
+            } );
+            return future;
+        }
+
+    private:
+
+        /// Job type held by the deques
+        using JOB_TYPE = std::move_only_function<void()>;
+
+        /**
+         * Deque of jobs, on its own cache line.
+         */
+        struct alignas( impl::cCache_Line_Size ) Queue
+        {
+            std::mutex           mutex;
+            std::deque<JOB_TYPE> jobs;
+        };
+
+        /**
+         * Pool and worker index of the calling thread, if it is a worker.
+         */
+        struct Worker_Id
+        {
+            const Thread_Pool* pool;
+            std::size_t        index;
+        };
+
+        /**
+         * @brief Let the workers drain the queues and exit, then join them.
+         */
+        void stop() noexcept
+        {
+            m_stop.store( true, std::memory_order_release );
+            wake( true );
+            for( auto& thread : m_threads )
+            {
+                thread.join();
+            }
+        }
+
+        void run( std::size_t index )
+        {
+            t_current = Worker_Id{ this, index };
+            while( true )
+            {
+                const auto epoch = m_epoch.load( std::memory_order_acquire );
+                if( auto job = find_job( index ) )
+                {
+                    ( *job )();
+                    continue;
+                }
+                if( m_stop.load( std::memory_order_acquire ) )
+                {
+                    return;
+                }
+                // Pairs with wake(): either it sees this worker sleeping, or this sees its bump
+                m_sleeping.fetch_add( 1, std::memory_order_seq_cst );
+                if( m_epoch.load( std::memory_order_seq_cst ) == epoch )
+                {
+                    m_epoch.wait( epoch, std::memory_order_acquire );
+                }
+                m_sleeping.fetch_sub( 1, std::memory_order_relaxed );
+            }
+        }
+
+        /**
+         * @brief Take the newest job from worker `index`'s deque, then the oldest shared job,
+         *        then steal the oldest job from another worker.
+         */
+        std::optional<JOB_TYPE> find_job( std::size_t index )
+        {
+            {
+                auto& own = m_queues[index];
+                std::lock_guard lock{ own.mutex };
+                if( !own.jobs.empty() )
+                {
+                    auto job = std::move( own.jobs.back() );
+                    own.jobs.pop_back();
+                    return job;
+                }
+            }
+            {
+                std::lock_guard lock{ m_shared.mutex };
+                if( !m_shared.jobs.empty() )
+                {
+                    auto job = std::move( m_shared.jobs.front() );
+                    m_shared.jobs.pop_front();
+                    return job;
+                }
+            }
+            for( std::size_t i = 1; i < m_queues.size(); ++i )
+            {
+                auto& victim = m_queues[( index + i ) % m_queues.size()];
+                std::unique_lock lock{ victim.mutex, std::try_to_lock };
+                if( lock.owns_lock() && !victim.jobs.empty() )
+                {
+                    auto job = std::move( victim.jobs.front() );
+                    victim.jobs.pop_front();
+                    return job;
+                }
+            }
+            // A victim may have been busy; look again before going to sleep
+            for( std::size_t i = 1; i < m_queues.size(); ++i )
+            {
+                auto& victim = m_queues[( index + i ) % m_queues.size()];
+                std::lock_guard lock{ victim.mutex };
+                if( !victim.jobs.empty() )
+                {
+                    auto job = std::move( victim.jobs.front() );
+                    victim.jobs.pop_front();
+                    return job;
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Bump the epoch so that sleeping workers recheck the deques.
+         */
+        void wake( bool all ) noexcept
+        {
+            m_epoch.fetch_add( 1, std::memory_order_seq_cst );
+            if( all )
+            {
+                m_epoch.notify_all();
+            }
+            else if( m_sleeping.load( std::memory_order_seq_cst ) != 0 )
+            {
+                m_epoch.notify_one();
+            }
+        }
+
+        /// Worker identity of the calling thread
+        static inline thread_local Worker_Id t_current{ nullptr, 0 };
+
+        /// One deque per worker
+        std::vector<Queue> m_queues;
+
+        /// Jobs posted from outside the pool
+        Queue m_shared;
+
+        /// Resource for the shared state of submitted jobs
+        std::pmr::memory_resource* m_resource;
+
+        /// Bumped by every post; idle workers wait on it
+        std::atomic<std::uint32_t> m_epoch{ 0 };
+
+        /// Number of workers waiting on `m_epoch`
+        std::atomic<std::uint32_t> m_sleeping{ 0 };
+
+        /// Set when the pool is destroyed
+        std::atomic<bool> m_stop{ false };
+
+        /// Worker threads
+        std::vector<std::thread> m_threads;
+
+}; // End of Thread_Pool Class
+
+} // End of tmns::outcome namespace
@@ -0,0 +1,681 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    wire.hpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Compact binary encoding of `Error` and `Result` for sending them between processes.
+ *
+ * An error is encoded as three varints and a byte string:
+ *
+ *     varint  category id      stable id from `wire_category_id()`
+ *     varint  code             zigzag-encoded
+ *     varint  details length
+ *     bytes   details
+ *
+ * A result is a tag byte, 0 for a value and 1 for an error, followed by the value as encoded by
+ * its `Wire_Codec`, or by the error.  Records carry no framing, so a buffer can hold any number
+ * of them back to back and be read with one `Wire_Reader`.
+*/
+#pragma once
+
+// C++ Standard Libraries
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/outcome/error.hpp>
+#include <terminus/outcome/error_category.hpp>
+#include <terminus/outcome/error_domain.hpp>
+#include <terminus/outcome/optional.hpp>
+#include <terminus/outcome/result.hpp>
+
+namespace tmns::outcome {
+
+namespace impl {
+
+/**
+ * Category registered with `register_wire_category()`.  Entries are linked into a list that
+ * lookups walk without a lock, and are never destroyed.
+ */
+struct Wire_Category_Entry
+{
+    std::uint32_t               id;
+    const std::error_category*  category;
+    const Wire_Category_Entry*  next;
+};
+
+/**
+ * @brief Most recently registered category.
+ */
+inline std::atomic<const Wire_Category_Entry*>& wire_categories() noexcept
+{
+    static constinit std::atomic<const Wire_Category_Entry*> head{ nullptr };
+    return head;
+}
+
+/**
+ * @brief Register `category` under `id`.
+ *
+ * @returns False if `id` is already taken by another category.
+ */
+inline bool add_wire_category( std::uint32_t id, const std::error_category& category )
+{
+    static std::mutex mutex;
+    std::lock_guard lock{ mutex };
+
+    auto& head = wire_categories();
+    for( auto entry = head.load( std::memory_order_acquire ); entry != nullptr; entry = entry->next )
+    {
+        if( entry->id == id )
+        {
+            return entry->category == &category;
+        }
+    }
+    head.store( new Wire_Category_Entry{ id, &category, head.load( std::memory_order_relaxed ) },
+                std::memory_order_release );
+    return true;
+}
+
+/**
+ * @brief Append `value` as a varint: seven bits per byte, low bits first, with the high bit set
+ *        on every byte but the last.
+ */
+inline void put_varint( std::vector<std::byte>& out, std::uint64_t value )
+{
+    while( value >= 0x80 )
+    {
+        out.push_back( static_cast<std::byte>( value | 0x80 ) );
+        value >>= 7;
+    }
+    out.push_back( static_cast<std::byte>( value ) );
+}
+
+/**
+ * @brief Map signed values to unsigned ones so that small magnitudes stay short as varints.
+ */
+constexpr std::uint64_t zigzag( std::int64_t value ) noexcept
+{
+    return ( static_cast<std::uint64_t>( value ) << 1 ) ^ static_cast<std::uint64_t>( value >> 63 );
+}
+
+/**
+ * @brief Inverse of `zigzag()`.
+ */
+constexpr std::int64_t unzigzag( std::uint64_t value ) noexcept
+{
+    return static_cast<std::int64_t>( value >> 1 ) ^ -static_cast<std::int64_t>( value & 1 );
+}
+
+/**
+ * @brief Append raw bytes.
+ */
+inline void put_bytes( std::vector<std::byte>& out, const void* data, std::size_t size )
+{
+    const auto bytes = static_cast<const std::byte*>( data );
+    out.insert( out.end(), bytes, bytes + size );
+}
+
+} // End of impl namespace
+
+/**
+ * @brief Stable id of the category of `ErrorCodeT` on the wire.
+ *
+ * A category can pick its id with a `static constexpr std::uint32_t cWireId` member, which keeps
+ * it to one or two bytes on the wire.  Otherwise the id is a hash of the category's `name()`,
+ * so it is the same in every process and build, unlike the category's address.
+ */
+template <class ErrorCodeT>
+std::uint32_t wire_category_id() noexcept
+{
+    using Category = impl::Category_Of<ErrorCodeT>;
+    if constexpr ( requires { { Category::cWireId } -> std::convertible_to<std::uint32_t>; } )
+    {
+        return Category::cWireId;
+    }
+    else
+    {
+        static const auto id = static_cast<std::uint32_t>( impl::hash_name( Category::get().name(), 0 ) );
+        return id;
+    }
+}
+
+/**
+ * @brief Make the category of `ErrorCodeT` known to `wire_category()`, so decoded errors can be
+ *        turned back into `std::error_code`s.
+ *
+ * Encoding an error registers its category, so a process only has to register the categories it
+ * decodes without ever encoding.  Registering again is cheap.
+ *
+ * @returns False if another category already has the same id; give one of them a `cWireId`.
+ */
+template <class ErrorCodeT>
+bool register_wire_category()
+{
+    static const bool registered = impl::add_wire_category( wire_category_id<ErrorCodeT>(),
+                                                            impl::Category_Of<ErrorCodeT>::get() );
+    return registered;
+}
+
+/**
+ * @brief Category registered under `id`, or null.
+ */
+inline const std::error_category* wire_category( std::uint32_t id ) noexcept
+{
+    for( auto entry = impl::wire_categories().load( std::memory_order_acquire ); entry != nullptr; entry = entry->next )
+    {
+        if( entry->id == id )
+        {
+            return entry->category;
+        }
+    }
+    return nullptr;
+}
+
+class Wire_Reader;
+
+/**
+ * Encoding of values on the wire.  Specialize it to send other value types in a `Result`, with:
+ *
+ * - `using view_type = ...;`, the decoded form, which may refer into the buffer
+ * - `static void encode( std::vector<std::byte>& out, const ValueT& value );`
+ * - `static Optional<view_type> decode( Wire_Reader& in );`
+ *
+ * Specializations are provided for `void`, `bool`, integers, floating point numbers, and
+ * strings.
+ */
+template <class ValueT>
+struct Wire_Codec;
+
+/**
+ * Decoded error.  The details refer into the buffer it was read from.
+ */
+struct Wire_Error_View
+{
+    /// Id of the category, from `wire_category_id()`
+    std::uint32_t category_id;
+
+    /// Code value
+    int code;
+
+    /// Details, in the buffer
+    std::string_view details;
+
+    /**
+     * @brief Category of the error, if it was registered in this process.
+     */
+    const std::error_category* category() const noexcept
+    {
+        return wire_category( category_id );
+    }
+
+    /**
+     * @brief The code with its category, if the category was registered in this process.
+     */
+    Optional<std::error_code> error_code() const noexcept
+    {
+        if( auto c = category() )
+        {
+            return std::error_code( code, *c );
+        }
+        return {};
+    }
+
+    /**
+     * @brief Check whether the error belongs to the category of `ErrorCodeT`.
+     */
+    template <class ErrorCodeT>
+    bool is() const noexcept
+    {
+        return category_id == wire_category_id<ErrorCodeT>();
+    }
+
+    /**
+     * @brief Copy into an `Error`, if it belongs to the category of `ErrorCodeT`.
+     */
+    template <class ErrorCodeT>
+    Optional<Error<ErrorCodeT>> to_error() const
+    {
+        if( !is<ErrorCodeT>() )
+        {
+            return {};
+        }
+        if( details.empty() )
+        {
+            return Error<ErrorCodeT>( static_cast<ErrorCodeT>( code ) );
+        }
+        return Error<ErrorCodeT>( static_cast<ErrorCodeT>( code ), details );
+    }
+};
+
+/**
+ * Decoded `Result<ValueT,E>`: a decoded value from `Wire_Codec<ValueT>`, or a decoded error.
+ */
+template <class ValueT>
+class Wire_Result_View
+{
+    public:
+
+        using view_type = typename Wire_Codec<ValueT>::view_type;
+
+        /**
+         * @brief Constructor for a value.
+         */
+        explicit Wire_Result_View( view_type value )
+          : m_state{ std::in_place_index<0>, std::move( value ) }
+        {}
+
+        /**
+         * @brief Constructor for an error.
+         */
+        explicit Wire_Result_View( const Wire_Error_View& error )
+          : m_state{ std::in_place_index<1>, error }
+        {}
+
+        bool has_value() const noexcept
+        {
+            return m_state.index() == 0;
+        }
+
+        bool has_error() const noexcept
+        {
+            return m_state.index() == 1;
+        }
+
+        /**
+         * @brief The decoded value.  Must only be called if `has_value()`.
+         */
+        const view_type& value() const noexcept
+        {
+            return *std::get_if<0>( &m_state );
+        }
+
+        /**
+         * @brief The decoded error.  Must only be called if `has_error()`.
+         */
+        const Wire_Error_View& error() const noexcept
+        {
+            return *std::get_if<1>( &m_state );
+        }
+
+        /**
+         * @brief Copy into a `Result`, unless the error belongs to another category than that of
+         *        `ErrorCodeT`.
+         */
+        template <class ErrorCodeT>
+        Optional<Result<ValueT,ErrorCodeT>> to_result() const
+        {
+            if( has_error() )
+            {
+                auto e = error().template to_error<ErrorCodeT>();
+                if( !e )
+                {
+                    return {};
+                }
+                return Result<ValueT,ErrorCodeT>{ impl::failure( std::move( *e ) ) };
+            }
+            if constexpr ( std::is_void_v<ValueT> )
+            {
+                return Result<ValueT,ErrorCodeT>{ impl::success() };
+            }
+            else
+            {
+                return Result<ValueT,ErrorCodeT>{ impl::success( ValueT( value() ) ) };
+            }
+        }
+
+    private:
+
+        std::variant<view_type,Wire_Error_View> m_state;
+
+}; // End of Wire_Result_View Class
+
+/**
+ * Zero-copy decoder of a buffer of encoded errors and results.
+ *
+ * Each read returns an empty `Optional` if the data is truncated or malformed, and then leaves
+ * the reader where it was.  Decoded views refer into the buffer, which must outlive them.
+ */
+class Wire_Reader
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param data Encoded records.
+         */
+        explicit Wire_Reader( std::span<const std::byte> data ) noexcept
+          : m_data{ data }
+        {}
+
+        /**
+         * @brief Check whether every byte was read.
+         */
+        bool empty() const noexcept
+        {
+            return m_pos == m_data.size();
+        }
+
+        /**
+         * @brief Number of bytes not read yet.
+         */
+        std::size_t remaining() const noexcept
+        {
+            return m_data.size() - m_pos;
+        }
+
+        /**
+         * @brief Read a varint.  Varints longer than ten bytes, or whose tenth byte carries bits
+         *        past bit 63, are rejected.
+         */
+        Optional<std::uint64_t> read_varint() noexcept
+        {
+            std::uint64_t value = 0;
+            for( std::size_t pos = m_pos, shift = 0; shift < 64 && pos < m_data.size(); shift += 7 )
+            {
+                const auto b = std::to_integer<std::uint64_t>( m_data[pos++] );
+                if( shift == 63 && b > 1 )
+                {
+                    return {};
+                }
+                value |= ( b & 0x7F ) << shift;
+                if( ( b & 0x80 ) == 0 )
+                {
+                    m_pos = pos;
+                    return value;
+                }
+            }
+            return {};
+        }
+
+        /**
+         * @brief Read `size` raw bytes, without copying them.
+         */
+        Optional<std::span<const std::byte>> read_bytes( std::size_t size ) noexcept
+        {
+            if( size > remaining() )
+            {
+                return {};
+            }
+            const auto bytes = m_data.subspan( m_pos, size );
+            m_pos += size;
+            return bytes;
+        }
+
+        /**
+         * @brief Read a length-prefixed string, without copying it.
+         */
+        Optional<std::string_view> read_string() noexcept
+        {
+            const auto start = m_pos;
+            const auto size  = read_varint();
+            if( !size || *size > remaining() )
+            {
+                m_pos = start;
+                return {};
+            }
+            const auto bytes = *read_bytes( static_cast<std::size_t>( *size ) );
+            return std::string_view( reinterpret_cast<const char*>( bytes.data() ), bytes.size() );
+        }
+
+        /**
+         * @brief Read an error written by `encode()`.
+         */
+        Optional<Wire_Error_View> read_error() noexcept
+        {
+            const auto start = m_pos;
+            const auto id      = read_varint();
+            const auto code    = id ? read_varint() : Optional<std::uint64_t>{};
+            const auto details = code ? read_string() : Optional<std::string_view>{};
+            if( !details || *id > std::numeric_limits<std::uint32_t>::max() )
+            {
+                m_pos = start;
+                return {};
+            }
+            const auto value = impl::unzigzag( *code );
+            if( value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max() )
+            {
+                m_pos = start;
+                return {};
+            }
+            return Wire_Error_View{ static_cast<std::uint32_t>( *id ), static_cast<int>( value ), *details };
+        }
+
+        /**
+         * @brief Read a `Result<ValueT,E>` written by `encode()`.
+         */
+        template <class ValueT>
+        Optional<Wire_Result_View<ValueT>> read_result()
+        {
+            const auto start = m_pos;
+            const auto tag = read_bytes( 1 );
+            if( tag && ( *tag )[0] == std::byte{ 0 } )
+            {
+                if( auto value = Wire_Codec<ValueT>::decode( *this ) )
+                {
+                    return Wire_Result_View<ValueT>{ std::move( *value ) };
+                }
+            }
+            else if( tag && ( *tag )[0] == std::byte{ 1 } )
+            {
+                if( auto error = read_error() )
+                {
+                    return Wire_Result_View<ValueT>{ *error };
+                }
+            }
+            m_pos = start;
+            return {};
+        }
+
+    private:
+
+        /// Encoded records
+        std::span<const std::byte> m_data;
+
+        /// Next byte to read
+        std::size_t m_pos{ 0 };
+
+}; // End of Wire_Reader Class
+
+/**
+ * Nothing is written for the value of a `Result<void,E>`.
+ */
+template <>
+struct Wire_Codec<void>
+{
+    using view_type = std::monostate;
+
+    static Optional<view_type> decode( Wire_Reader& ) noexcept
+    {
+        return view_type{};
+    }
+};
+
+/**
+ * Booleans are one byte.
+ */
+template <>
+struct Wire_Codec<bool>
+{
+    using view_type = bool;
+
+    static void encode( std::vector<std::byte>& out, bool value )
+    {
+        out.push_back( std::byte{ value } );
+    }
+
+    static Optional<view_type> decode( Wire_Reader& in ) noexcept
+    {
+        const auto b = in.read_bytes( 1 );
+        if( !b || ( *b )[0] > std::byte{ 1 } )
+        {
+            return {};
+        }
+        return ( *b )[0] == std::byte{ 1 };
+    }
+};
+
+/**
+ * Integers are varints, zigzag-encoded when signed.
+ */
+template <class ValueT>
+  requires ( std::integral<ValueT> && !std::same_as<ValueT,bool> )
+struct Wire_Codec<ValueT>
+{
+    using view_type = ValueT;
+
+    static void encode( std::vector<std::byte>& out, ValueT value )
+    {
+        if constexpr ( std::is_signed_v<ValueT> )
+        {
+            impl::put_varint( out, impl::zigzag( value ) );
+        }
+        else
+        {
+            impl::put_varint( out, value );
+        }
+    }
+
+    static Optional<view_type> decode( Wire_Reader& in ) noexcept
+    {
+        const auto raw = in.read_varint();
+        if( !raw )
+        {
+            return {};
+        }
+        if constexpr ( std::is_signed_v<ValueT> )
+        {
+            const auto value = impl::unzigzag( *raw );
+            if( value < std::numeric_limits<ValueT>::min() || value > std::numeric_limits<ValueT>::max() )
+            {
+                return {};
+            }
+            return static_cast<ValueT>( value );
+        }
+        else
+        {
+            if( *raw > std::numeric_limits<ValueT>::max() )
+            {
+                return {};
+            }
+            return static_cast<ValueT>( *raw );
+        }
+    }
+};
+
+/**
+ * Floating point numbers are their IEEE 754 bits, little-endian.
+ */
+template <class ValueT>
+  requires ( std::same_as<ValueT,float> || std::same_as<ValueT,double> )
+struct Wire_Codec<ValueT>
+{
+    using view_type = ValueT;
+    using Bits      = std::conditional_t<sizeof( ValueT ) == 4, std::uint32_t, std::uint64_t>;
+
+    static void encode( std::vector<std::byte>& out, ValueT value )
+    {
+        auto bits = std::bit_cast<Bits>( value );
+        if constexpr ( std::endian::native == std::endian::big )
+        {
+            bits = std::byteswap( bits );
+        }
+        impl::put_bytes( out, &bits, sizeof( bits ) );
+    }
+
+    static Optional<view_type> decode( Wire_Reader& in ) noexcept
+    {
+        const auto bytes = in.read_bytes( sizeof( Bits ) );
+        if( !bytes )
+        {
+            return {};
+        }
+        Bits bits;
+        std::memcpy( &bits, bytes->data(), sizeof( bits ) );
+        if constexpr ( std::endian::native == std::endian::big )
+        {
+            bits = std::byteswap( bits );
+        }
+        return std::bit_cast<ValueT>( bits );
+    }
+};
+
+/**
+ * Strings are length-prefixed, and decode to a view into the buffer.
+ */
+template <class ValueT>
+  requires ( std::same_as<ValueT,std::string> || std::same_as<ValueT,std::string_view> )
+struct Wire_Codec<ValueT>
+{
+    using view_type = std::string_view;
+
+    static void encode( std::vector<std::byte>& out, std::string_view value )
+    {
+        impl::put_varint( out, value.size() );
+        impl::put_bytes( out, value.data(), value.size() );
+    }
+
+    static Optional<view_type> decode( Wire_Reader& in ) noexcept
+    {
+        return in.read_string();
+    }
+};
+
+/**
+ * @brief Append the wire encoding of `error` to `out`, and register its category.
+ */
+template <class ErrorCodeT>
+void encode( std::vector<std::byte>& out, const Error<ErrorCodeT>& error )
+{
+    register_wire_category<ErrorCodeT>();
+    const auto details = error.details();
+    impl::put_varint( out, wire_category_id<ErrorCodeT>() );
+    impl::put_varint( out, impl::zigzag( error.code().value() ) );
+    impl::put_varint( out, details.size() );
+    impl::put_bytes( out, details.data(), details.size() );
+}
+
+/**
+ * @brief Append the wire encoding of `result` to `out`.
+ */
+template <class ValueT, class ErrorCodeT>
+void encode( std::vector<std::byte>& out, const Result<ValueT,ErrorCodeT>& result )
+{
+    if( result.has_value() )
+    {
+        out.push_back( std::byte{ 0 } );
+        if constexpr ( !std::is_void_v<ValueT> )
+        {
+            Wire_Codec<std::remove_cvref_t<ValueT>>::encode( out, result.assume_value() );
+        }
+    }
+    else
+    {
+        out.push_back( std::byte{ 1 } );
+        encode( out, result.assume_error() );
+    }
+}
+
+} // End of tmns::outcome namespace
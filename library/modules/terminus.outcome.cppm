@@ -0,0 +1,117 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    terminus.outcome.cppm
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Primary interface of the `terminus.outcome` module.  It wraps the headers in the global module
+ * fragment and exports the public API, so importers parse them once per build instead of once
+ * per translation unit.
+ *
+ * Modules cannot export macros.  Code that uses `TERMINUS_OUTCOME_TRY` still includes
+ * `terminus/outcome/macros.hpp`, which only needs the standard library.
+*/
+module;
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/coroutine.hpp>
+#include <terminus/outcome/error_counters.hpp>
+#include <terminus/outcome/error_observer.hpp>
+#include <terminus/outcome/format.hpp>
+#include <terminus/outcome/future_combinators.hpp>
+#include <terminus/outcome/json.hpp>
+#include <terminus/outcome/multi_error.hpp>
+#include <terminus/outcome/panic.hpp>
+#include <terminus/outcome/result_batch.hpp>
+#include <terminus/outcome/result_future.hpp>
+#include <terminus/outcome/thread_pool.hpp>
+#include <terminus/outcome/wire.hpp>
+
+export module terminus.outcome;
+
+export namespace tmns::outcome {
+
+using tmns::outcome::as_result;
+using tmns::outcome::cDeferred;
+using tmns::outcome::cEmpty;
+using tmns::outcome::encode;
+using tmns::outcome::count_error;
+using tmns::outcome::Deferred;
+using tmns::outcome::Empty;
+using tmns::outcome::Error;
+using tmns::outcome::Error_Arena;
+using tmns::outcome::Error_Category;
+using tmns::outcome::Error_Context;
+using tmns::outcome::Error_Count;
+using tmns::outcome::Error_Event;
+using tmns::outcome::Error_Observer;
+using tmns::outcome::Error_Record;
+using tmns::outcome::Error_Ring_Buffer;
+using tmns::outcome::Error_Stacktrace;
+using tmns::outcome::error_code_count;
+using tmns::outcome::error_code_name;
+using tmns::outcome::error_counts;
+using tmns::outcome::error_memory_resource;
+using tmns::outcome::fail;
+#if defined( TERMINUS_OUTCOME_HAS_FORMAT )
+using tmns::outcome::cFormat;
+using tmns::outcome::Format;
+#endif
+using tmns::outcome::FutureResult;
+using tmns::outcome::make_error_code;
+using tmns::outcome::Multi_Error;
+using tmns::outcome::Multi_Error_Collector;
+using tmns::outcome::ok;
+using tmns::outcome::Optional;
+using tmns::outcome::Optional_Niche;
+using tmns::outcome::Optional_Sentinel;
+using tmns::outcome::panic;
+using tmns::outcome::Panic_Handler;
+using tmns::outcome::Panic_Info;
+using tmns::outcome::parse_error_code;
+using tmns::outcome::Result;
+using tmns::outcome::Result_Batch;
+using tmns::outcome::Result_Future;
+using tmns::outcome::Result_Promise;
+using tmns::outcome::register_wire_category;
+using tmns::outcome::Result_Slot;
+using tmns::outcome::Scoped_Error_Arena;
+using tmns::outcome::set_error_observer;
+using tmns::outcome::set_panic_handler;
+using tmns::outcome::Stacktrace_Policy;
+using tmns::outcome::Task;
+using tmns::outcome::Thread_Pool;
+using tmns::outcome::when_all;
+using tmns::outcome::when_any;
+using tmns::outcome::wire_category;
+using tmns::outcome::wire_category_id;
+using tmns::outcome::Wire_Codec;
+using tmns::outcome::Wire_Error_View;
+using tmns::outcome::Wire_Reader;
+using tmns::outcome::Wire_Result_View;
+using tmns::outcome::write_json;
+using tmns::outcome::write_prometheus;
+using tmns::outcome::operator co_await;
+using tmns::outcome::operator<<;
+
+} // End of tmns::outcome namespace
+
+export namespace tmns::core::error {
+
+using tmns::core::error::Error_Category;
+using tmns::core::error::Error_Code;
+using tmns::core::error::make_error_code;
+
+} // End of tmns::core::error namespace
+
+export using ::Result;
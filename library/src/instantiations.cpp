@@ -0,0 +1,20 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    instantiations.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Compiles the explicit instantiations declared in `terminus/error/extern_templates.hpp`.
+*/
+#define TERMINUS_OUTCOME_INSTANTIATE_TEMPLATES
+
+// Terminus Libraries
+#include <terminus/error/extern_templates.hpp>
@@ -0,0 +1,145 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_algorithms.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Cost of the parallel algorithms on a batch of tile jobs, and how much of it the first-error
+ * latch saves when a job fails early.  `collect()` runs every job regardless, so it is the
+ * baseline for the failing batches.
+ */
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/algorithms.hpp>
+#include <terminus/outcome/thread_pool.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+/// Jobs per batch
+constexpr int cBatch_Size = 4096;
+
+/// Rounds of work per job, roughly a microsecond
+constexpr int cRounds = 1000;
+
+/**
+ * @brief Stand-in for a tile job, failing for input `fail_at`.
+ */
+Result<std::uint64_t> tile_job( int input, int fail_at )
+{
+    if( input == fail_at )
+    {
+        return tmns::outcome::fail( TestErrorCode::FIRST );
+    }
+    std::uint64_t x = static_cast<std::uint64_t>( input ) | 1;
+    for( int i = 0; i < cRounds; ++i )
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+/**
+ * @brief Inputs of one batch.
+ */
+std::vector<int> batch()
+{
+    std::vector<int> inputs( cBatch_Size );
+    std::iota( inputs.begin(), inputs.end(), 0 );
+    return inputs;
+}
+
+} // End of anonymous namespace
+
+/**
+ * `transform_results()` on a pool.  The argument is the index of the failing job, or the batch
+ * size for none.
+ */
+static void BM_Transform_Results_Pool( benchmark::State& state )
+{
+    tmns::outcome::Thread_Pool pool;
+    const auto inputs  = batch();
+    const auto fail_at = static_cast<int>( state.range( 0 ) );
+    for( auto _ : state )
+    {
+        auto r = tmns::outcome::transform_results( pool, inputs, [=]( int v ) { return tile_job( v, fail_at ); } );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetItemsProcessed( state.iterations() * cBatch_Size );
+}
+BENCHMARK( BM_Transform_Results_Pool )->Arg( 16 )->Arg( cBatch_Size / 2 )->Arg( cBatch_Size )->UseRealTime();
+
+/**
+ * `transform_results()` under `std::execution::par`.
+ */
+static void BM_Transform_Results_Par( benchmark::State& state )
+{
+    const auto inputs  = batch();
+    const auto fail_at = static_cast<int>( state.range( 0 ) );
+    for( auto _ : state )
+    {
+        auto r = tmns::outcome::transform_results( std::execution::par, inputs, [=]( int v ) { return tile_job( v, fail_at ); } );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetItemsProcessed( state.iterations() * cBatch_Size );
+}
+BENCHMARK( BM_Transform_Results_Par )->Arg( 16 )->Arg( cBatch_Size )->UseRealTime();
+
+/**
+ * `collect()` on a pool, which has no early exit.
+ */
+static void BM_Collect_Pool( benchmark::State& state )
+{
+    tmns::outcome::Thread_Pool pool;
+    const auto inputs  = batch();
+    const auto fail_at = static_cast<int>( state.range( 0 ) );
+    for( auto _ : state )
+    {
+        auto r = tmns::outcome::collect( pool, inputs, [=]( int v ) { return tile_job( v, fail_at ); } );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetItemsProcessed( state.iterations() * cBatch_Size );
+}
+BENCHMARK( BM_Collect_Pool )->Arg( 16 )->UseRealTime();
+
+/**
+ * `transform_reduce_results()` on a pool, summing the jobs.
+ */
+static void BM_Transform_Reduce_Results_Pool( benchmark::State& state )
+{
+    tmns::outcome::Thread_Pool pool;
+    const auto inputs = batch();
+    for( auto _ : state )
+    {
+        auto r = tmns::outcome::transform_reduce_results( pool, inputs, std::uint64_t{ 0 }, std::plus<>{},
+                                                          []( int v ) { return tile_job( v, cBatch_Size ); } );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetItemsProcessed( state.iterations() * cBatch_Size );
+}
+BENCHMARK( BM_Transform_Reduce_Results_Pool )->UseRealTime();
@@ -0,0 +1,120 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_coroutine.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Cost of propagating through `co_await` in coroutines returning `Result` and in `Task`s,
+ * next to the `TERMINUS_OUTCOME_TRY` chains in `BENCH_result.cpp`.
+ */
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/coroutine.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+template <class ValueT>
+using Task = tmns::outcome::Task<Result<ValueT>>;
+
+/****************************************/
+/*        Coroutines Returning Result   */
+/****************************************/
+/**
+ * Innermost function of the chains, which fails when asked to.
+ */
+[[gnu::noinline]] static Result<int> leaf( int i, bool should_fail )
+{
+    if( should_fail )
+    {
+        return tmns::outcome::fail( TestErrorCode::SECOND );
+    }
+    return i;
+}
+
+/**
+ * Chain of `DepthT` coroutines, each awaiting the result of the next.
+ */
+template <int DepthT>
+[[gnu::noinline]] Result<int> await_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 1 )
+    {
+        co_return co_await leaf( i, should_fail ) + 1;
+    }
+    else
+    {
+        co_return co_await await_chain<DepthT - 1>( i, should_fail ) + 1;
+    }
+}
+
+/**
+ * Propagate through `DepthT` layers.  `range(0)` selects success (0) or failure (1).
+ */
+template <int DepthT>
+static void BM_Coroutine_Await_Depth( benchmark::State& state )
+{
+    const bool should_fail = state.range( 0 ) != 0;
+    int i = 0;
+    for( auto _ : state )
+    {
+        auto r = await_chain<DepthT>( ++i, should_fail );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetLabel( should_fail ? "fail" : "ok" );
+}
+BENCHMARK_TEMPLATE( BM_Coroutine_Await_Depth, 1 )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Coroutine_Await_Depth, 8 )->Arg( 0 )->Arg( 1 );
+
+/****************************************/
+/*                Tasks                 */
+/****************************************/
+/**
+ * Chain of `DepthT` tasks, each awaiting the next.
+ */
+template <int DepthT>
+Task<int> task_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 1 )
+    {
+        co_return co_await leaf( i, should_fail ) + 1;
+    }
+    else
+    {
+        co_return co_await task_chain<DepthT - 1>( i, should_fail ) + 1;
+    }
+}
+
+/**
+ * Await a chain of `DepthT` tasks from one outer task, started and read on the calling thread.
+ * `range(0)` selects success (0) or failure (1).
+ */
+template <int DepthT>
+static void BM_Coroutine_Task_Depth( benchmark::State& state )
+{
+    const bool should_fail = state.range( 0 ) != 0;
+    int i = 0;
+    for( auto _ : state )
+    {
+        auto r = task_chain<DepthT>( ++i, should_fail ).start().get();
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetLabel( should_fail ? "fail" : "ok" );
+}
+BENCHMARK_TEMPLATE( BM_Coroutine_Task_Depth, 1 )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Coroutine_Task_Depth, 8 )->Arg( 0 )->Arg( 1 );
@@ -0,0 +1,319 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_error.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/error_counters.hpp>
+#include <terminus/outcome/format.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+/****************************************/
+/*        Error Construction Costs      */
+/****************************************/
+/**
+ * Construct an error carrying only a code.
+ */
+static void BM_Error_Construct_Code_Only( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { TestErrorCode::FIRST };
+        benchmark::DoNotOptimize( e );
+    }
+}
+BENCHMARK( BM_Error_Construct_Code_Only );
+
+/**
+ * Construct an error whose details are formatted immediately.
+ */
+static void BM_Error_Construct_Eager( benchmark::State& state )
+{
+    int tile = 0;
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { TestErrorCode::FIRST, "unable to read tile ", tile++, " of ", 4096 };
+        benchmark::DoNotOptimize( e );
+    }
+}
+BENCHMARK( BM_Error_Construct_Eager );
+
+/**
+ * Construct an error whose details are formatted on first use, then only inspect the code.
+ */
+static void BM_Error_Construct_Deferred( benchmark::State& state )
+{
+    int tile = 0;
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { tmns::outcome::cDeferred, TestErrorCode::FIRST, "unable to read tile ", tile++, " of ", 4096 };
+        benchmark::DoNotOptimize( e.code() );
+    }
+}
+BENCHMARK( BM_Error_Construct_Deferred );
+
+/**
+ * Construct a deferred error and render its details, the worst case for deferred mode.
+ */
+static void BM_Error_Construct_Deferred_Then_Render( benchmark::State& state )
+{
+    int tile = 0;
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { tmns::outcome::cDeferred, TestErrorCode::FIRST, "unable to read tile ", tile++, " of ", 4096 };
+        benchmark::DoNotOptimize( e.details().size() );
+    }
+}
+BENCHMARK( BM_Error_Construct_Deferred_Then_Render );
+
+/****************************************/
+/*        Error Propagation Costs       */
+/****************************************/
+/**
+ * Copy an error carrying details, as happens when it propagates by value.
+ */
+static void BM_Error_Copy_With_Details( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TestErrorCode::FIRST, "unable to read tile ", 17 };
+    for( auto _ : state )
+    {
+        auto copy = e;
+        benchmark::DoNotOptimize( copy );
+    }
+}
+BENCHMARK( BM_Error_Copy_With_Details );
+
+/****************************************/
+/*     Error Allocation Under Threads   */
+/****************************************/
+/**
+ * Errors with details allocated from the global heap by every thread.
+ */
+static void BM_Error_Details_Global_Heap( benchmark::State& state )
+{
+    int tile = 0;
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { TestErrorCode::FIRST, "unable to read tile ", tile++ };
+        benchmark::DoNotOptimize( e );
+    }
+}
+BENCHMARK( BM_Error_Details_Global_Heap )->ThreadRange( 1, 64 )->UseRealTime();
+
+/**
+ * Errors with details allocated from each thread's arena, which is reset after every "tile"
+ * of 1024 errors.
+ */
+static void BM_Error_Details_Thread_Arena( benchmark::State& state )
+{
+    auto& arena = tmns::outcome::Error_Arena::thread_local_instance();
+    int tile = 0;
+    for( auto _ : state )
+    {
+        {
+            tmns::outcome::Scoped_Error_Arena scope{ arena };
+            tmns::outcome::Error e { TestErrorCode::FIRST, "unable to read tile ", tile };
+            benchmark::DoNotOptimize( e );
+        }
+        if( ( ++tile & 1023 ) == 0 )
+        {
+            arena.reset();
+        }
+    }
+}
+BENCHMARK( BM_Error_Details_Thread_Arena )->ThreadRange( 1, 64 )->UseRealTime();
+
+/****************************************/
+/*           Message Rendering          */
+/****************************************/
+/**
+ * Render the full message of an error without details.
+ */
+static void BM_Error_Message_Code_Only( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TestErrorCode::SECOND };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( e.message() );
+    }
+}
+BENCHMARK( BM_Error_Message_Code_Only );
+
+/**
+ * Render the full message of an error with details.
+ */
+static void BM_Error_Message_With_Details( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TestErrorCode::SECOND, "tile ", 3, " of ", 12, " is missing" };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( e.message() );
+    }
+}
+BENCHMARK( BM_Error_Message_With_Details );
+
+/**
+ * Render the full message of an error whose category has a message table.
+ */
+static void BM_Error_Message_Table( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TableErrorCode::SECOND, "tile ", 3, " of ", 12, " is missing" };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( e.message() );
+    }
+}
+BENCHMARK( BM_Error_Message_Table );
+
+#if defined( TERMINUS_OUTCOME_HAS_FORMAT )
+/**
+ * Format an error whose category has a message table into a reused buffer.
+ */
+static void BM_Error_Format_Table( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TableErrorCode::SECOND, "tile ", 3, " of ", 12, " is missing" };
+    std::string out;
+    for( auto _ : state )
+    {
+        out.clear();
+        std::format_to( std::back_inserter( out ), "{}", e );
+        benchmark::DoNotOptimize( out.data() );
+    }
+}
+BENCHMARK( BM_Error_Format_Table );
+
+/**
+ * Create a failure with details in `std::format` syntax.
+ */
+static void BM_Error_Fail_Format( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        tmns::outcome::Result<int,TestErrorCode> r =
+            tmns::outcome::fail( tmns::outcome::cFormat, TestErrorCode::SECOND, "tile {} of {} is missing", 3, 12 );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Error_Fail_Format );
+
+/**
+ * Create a failure whose details are concatenated, for comparison with the formatted form.
+ */
+static void BM_Error_Fail_Concatenate( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        tmns::outcome::Result<int,TestErrorCode> r =
+            tmns::outcome::fail( TestErrorCode::SECOND, "tile ", 3, " of ", 12, " is missing" );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Error_Fail_Concatenate );
+#endif
+
+/****************************************/
+/*          Code Message Lookup         */
+/****************************************/
+/**
+ * Look up the code message through the virtual `std::error_category::message()`.
+ */
+static void BM_Error_Code_Message_Virtual( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TableErrorCode::SECOND };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( e.code().message() );
+    }
+}
+BENCHMARK( BM_Error_Code_Message_Virtual );
+
+/**
+ * Look up the code message through the category's constexpr table.
+ */
+static void BM_Error_Code_Message_View( benchmark::State& state )
+{
+    const tmns::outcome::Error e { TableErrorCode::SECOND };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( e.code_message() );
+    }
+}
+BENCHMARK( BM_Error_Code_Message_View );
+
+/****************************************/
+/*            Context Chain             */
+/****************************************/
+/**
+ * Append one context frame per layer while an error propagates through `range(0)` layers.
+ */
+static void BM_Error_Append_Depth( benchmark::State& state )
+{
+    const auto depth = state.range( 0 );
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { TestErrorCode::FIRST, "tile ", 3 };
+        for( int64_t i = 0; i < depth; ++i )
+        {
+            e.append( "while processing layer" );
+        }
+        benchmark::DoNotOptimize( e );
+    }
+    state.SetComplexityN( depth );
+}
+BENCHMARK( BM_Error_Append_Depth )->RangeMultiplier( 4 )->Range( 1, 256 )->Complexity();
+
+/**
+ * Same as `BM_Error_Append_Depth`, then flatten the details once at the top.
+ */
+static void BM_Error_Append_Depth_Then_Render( benchmark::State& state )
+{
+    const auto depth = state.range( 0 );
+    for( auto _ : state )
+    {
+        tmns::outcome::Error e { TestErrorCode::FIRST, "tile ", 3 };
+        for( int64_t i = 0; i < depth; ++i )
+        {
+            e.append( "while processing layer" );
+        }
+        benchmark::DoNotOptimize( e.details() );
+    }
+    state.SetComplexityN( depth );
+}
+BENCHMARK( BM_Error_Append_Depth_Then_Render )->RangeMultiplier( 4 )->Range( 1, 256 )->Complexity();
+
+/****************************************/
+/*            Error Counters            */
+/****************************************/
+/**
+ * One increment of the per-code counters, which `TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS` adds to
+ * every error constructed.  Run with several threads to see the effect of sharing shards.
+ */
+static void BM_Error_Count( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        tmns::outcome::count_error( TestErrorCode::FIRST );
+    }
+}
+BENCHMARK( BM_Error_Count )->ThreadRange( 1, 8 );
@@ -0,0 +1,178 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_error_handling.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Compares `Result`, exceptions and `std::expected` propagating through the same call chain
+ * over a sweep of failure rates.  `range(0)` is the failure rate in percent.
+ */
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+#include <version>
+
+#if defined( __cpp_lib_expected )
+    #include <expected>
+#endif
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+/// Number of functions between the failure and the handler
+constexpr int cChainDepth = 8;
+
+/**
+ * True for `rate` out of every 100 iterations, spread evenly.
+ */
+bool fails_at( std::int64_t i, std::int64_t rate ) noexcept
+{
+    return ( i * 37 ) % 100 < rate;
+}
+
+/****************************************/
+/*               Result                 */
+/****************************************/
+template <int DepthT>
+[[gnu::noinline]] Result<int> result_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 0 )
+    {
+        if( should_fail )
+        {
+            return tmns::outcome::fail( TestErrorCode::SECOND );
+        }
+        return i;
+    }
+    else
+    {
+        TERMINUS_OUTCOME_TRY( auto v, result_chain<DepthT - 1>( i, should_fail ) );
+        return v + 1;
+    }
+}
+
+/****************************************/
+/*              Exceptions              */
+/****************************************/
+template <int DepthT>
+[[gnu::noinline]] int exception_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 0 )
+    {
+        if( should_fail )
+        {
+            throw std::system_error( make_error_code( TestErrorCode::SECOND ) );
+        }
+        return i;
+    }
+    else
+    {
+        return exception_chain<DepthT - 1>( i, should_fail ) + 1;
+    }
+}
+
+#if defined( __cpp_lib_expected )
+/****************************************/
+/*            std::expected             */
+/****************************************/
+template <int DepthT>
+[[gnu::noinline]] std::expected<int,std::error_code> expected_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 0 )
+    {
+        if( should_fail )
+        {
+            return std::unexpected( make_error_code( TestErrorCode::SECOND ) );
+        }
+        return i;
+    }
+    else
+    {
+        auto r = expected_chain<DepthT - 1>( i, should_fail );
+        if( !r )
+        {
+            return std::unexpected( r.error() );
+        }
+        return *r + 1;
+    }
+}
+#endif
+
+} // End of anonymous namespace
+
+static void BM_Handling_Result( benchmark::State& state )
+{
+    const auto rate = state.range( 0 );
+    std::int64_t i = 0;
+    std::int64_t failures = 0;
+    for( auto _ : state )
+    {
+        auto r = result_chain<cChainDepth>( static_cast<int>( i ), fails_at( i, rate ) );
+        failures += r.has_error();
+        benchmark::DoNotOptimize( r );
+        ++i;
+    }
+    benchmark::DoNotOptimize( failures );
+}
+BENCHMARK( BM_Handling_Result )->Arg( 0 )->Arg( 1 )->Arg( 10 )->Arg( 50 )->Arg( 100 );
+
+static void BM_Handling_Exceptions( benchmark::State& state )
+{
+    const auto rate = state.range( 0 );
+    std::int64_t i = 0;
+    std::int64_t failures = 0;
+    for( auto _ : state )
+    {
+        try
+        {
+            auto v = exception_chain<cChainDepth>( static_cast<int>( i ), fails_at( i, rate ) );
+            benchmark::DoNotOptimize( v );
+        }
+        catch( const std::system_error& )
+        {
+            ++failures;
+        }
+        ++i;
+    }
+    benchmark::DoNotOptimize( failures );
+}
+BENCHMARK( BM_Handling_Exceptions )->Arg( 0 )->Arg( 1 )->Arg( 10 )->Arg( 50 )->Arg( 100 );
+
+#if defined( __cpp_lib_expected )
+static void BM_Handling_Std_Expected( benchmark::State& state )
+{
+    const auto rate = state.range( 0 );
+    std::int64_t i = 0;
+    std::int64_t failures = 0;
+    for( auto _ : state )
+    {
+        auto r = expected_chain<cChainDepth>( static_cast<int>( i ), fails_at( i, rate ) );
+        failures += !r.has_value();
+        benchmark::DoNotOptimize( r );
+        ++i;
+    }
+    benchmark::DoNotOptimize( failures );
+}
+BENCHMARK( BM_Handling_Std_Expected )->Arg( 0 )->Arg( 1 )->Arg( 10 )->Arg( 50 )->Arg( 100 );
+#endif
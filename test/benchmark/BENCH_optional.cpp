@@ -0,0 +1,139 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_optional.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+
+/****************************************/
+/*     Optional <-> std::optional       */
+/****************************************/
+/**
+ * Convert an engaged `Optional<int>` to a `std::optional<int>`.
+ */
+static void BM_Optional_To_Std_Int( benchmark::State& state )
+{
+    tmns::outcome::Optional<int> o{ 42 };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( o );
+        std::optional<int> s = o;
+        benchmark::DoNotOptimize( s );
+    }
+}
+BENCHMARK( BM_Optional_To_Std_Int );
+
+/**
+ * Convert an engaged `std::optional<int>` to an `Optional<int>`.
+ */
+static void BM_Optional_From_Std_Int( benchmark::State& state )
+{
+    std::optional<int> s{ 42 };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( s );
+        tmns::outcome::Optional<int> o{ s };
+        benchmark::DoNotOptimize( o );
+    }
+}
+BENCHMARK( BM_Optional_From_Std_Int );
+
+/**
+ * Convert an empty `Optional<int>` to a `std::optional<int>`.
+ */
+static void BM_Optional_To_Std_Empty( benchmark::State& state )
+{
+    tmns::outcome::Optional<int> o{ tmns::outcome::cEmpty };
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( o );
+        std::optional<int> s = o;
+        benchmark::DoNotOptimize( s );
+    }
+}
+BENCHMARK( BM_Optional_To_Std_Empty );
+
+/**
+ * Copy-convert an `Optional<std::string>` to a `std::optional<std::string>`.
+ */
+static void BM_Optional_To_Std_String_Copy( benchmark::State& state )
+{
+    const tmns::outcome::Optional<std::string> o{ std::string( 64, 'x' ) };
+    for( auto _ : state )
+    {
+        std::optional<std::string> s = o;
+        benchmark::DoNotOptimize( s );
+    }
+}
+BENCHMARK( BM_Optional_To_Std_String_Copy );
+
+/**
+ * Move-convert an `Optional<std::string>` to a `std::optional<std::string>` and back.
+ */
+static void BM_Optional_Std_String_Round_Trip_Move( benchmark::State& state )
+{
+    tmns::outcome::Optional<std::string> o{ std::string( 64, 'x' ) };
+    for( auto _ : state )
+    {
+        std::optional<std::string> s = std::move( o );
+        o = std::move( s );
+        benchmark::DoNotOptimize( o );
+    }
+}
+BENCHMARK( BM_Optional_Std_String_Round_Trip_Move );
+
+/****************************************/
+/*        Arrays of Optional Samples    */
+/****************************************/
+/**
+ * Sum an array of optional samples, every fourth one missing.  `Optional<double>` is packed into
+ * a NaN niche, so the array is half the size of one of `std::optional<double>`.
+ */
+template <class OptionalT>
+static void BM_Optional_Sample_Sum( benchmark::State& state )
+{
+    std::vector<OptionalT> samples( static_cast<std::size_t>( state.range( 0 ) ) );
+    for( std::size_t i = 0; i < samples.size(); ++i )
+    {
+        if( i % 4 != 0 )
+        {
+            samples[i] = 0.5 * static_cast<double>( i );
+        }
+    }
+    for( auto _ : state )
+    {
+        double sum = 0;
+        for( const auto& s : samples )
+        {
+            if( s.has_value() )
+            {
+                sum += *s;
+            }
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) * sizeof( OptionalT ) );
+}
+BENCHMARK( BM_Optional_Sample_Sum<tmns::outcome::Optional<double>> )->Arg( 1 << 20 );
+BENCHMARK( BM_Optional_Sample_Sum<std::optional<double>> )->Arg( 1 << 20 );
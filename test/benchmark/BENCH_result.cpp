@@ -0,0 +1,205 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_result.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <string>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+/****************************************/
+/*       Source Location Overhead       */
+/****************************************/
+/**
+ * Fail through `fail()`, which records the source location when
+ * `TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION` is defined.
+ */
+[[gnu::noinline]] static Result<int> fail_with_origin( int i )
+{
+    return tmns::outcome::fail( static_cast<TestErrorCode>( i & 1 ) );
+}
+
+/**
+ * Fail by returning an error directly, which leaves the source location empty.
+ */
+[[gnu::noinline]] static Result<int> fail_without_origin( int i )
+{
+    return tmns::outcome::Error{ static_cast<TestErrorCode>( i & 1 ) };
+}
+
+static void BM_Result_Fail_With_Origin( benchmark::State& state )
+{
+    int i = 0;
+    for( auto _ : state )
+    {
+        auto r = fail_with_origin( ++i );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Fail_With_Origin );
+
+static void BM_Result_Fail_Without_Origin( benchmark::State& state )
+{
+    int i = 0;
+    for( auto _ : state )
+    {
+        auto r = fail_without_origin( ++i );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Fail_Without_Origin );
+
+/**
+ * Read the origin back, as a logger would.
+ */
+static void BM_Result_Read_Origin( benchmark::State& state )
+{
+    const auto r = fail_with_origin( 1 );
+    for( auto _ : state )
+    {
+        const auto where = r.assume_error().origin();
+        benchmark::DoNotOptimize( where.file_name() );
+        benchmark::DoNotOptimize( where.line() );
+    }
+}
+BENCHMARK( BM_Result_Read_Origin );
+
+/****************************************/
+/*          Result Construction         */
+/****************************************/
+/**
+ * Construct a successful result with `ok<T>()`.
+ */
+static void BM_Result_Ok_Int( benchmark::State& state )
+{
+    int i = 0;
+    for( auto _ : state )
+    {
+        Result<int> r = tmns::outcome::ok<int>( ++i );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Ok_Int );
+
+/**
+ * Construct a successful result holding a string that fits the small string buffer.
+ */
+static void BM_Result_Ok_String( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        Result<std::string> r = tmns::outcome::ok<std::string>( "tile_0001" );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Ok_String );
+
+/**
+ * Construct a failed result carrying only a code.
+ */
+static void BM_Result_Fail_Code_Only( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        Result<int> r = tmns::outcome::fail( TestErrorCode::FIRST );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Fail_Code_Only );
+
+/**
+ * Construct a failed result with formatted details.
+ */
+static void BM_Result_Fail_With_Details( benchmark::State& state )
+{
+    int i = 0;
+    for( auto _ : state )
+    {
+        Result<int> r = tmns::outcome::fail( TestErrorCode::FIRST, "tile ", ++i, " is missing" );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Fail_With_Details );
+
+/**
+ * Construct a failed result with deferred details.
+ */
+static void BM_Result_Fail_Deferred( benchmark::State& state )
+{
+    int i = 0;
+    for( auto _ : state )
+    {
+        Result<int> r = tmns::outcome::fail( tmns::outcome::cDeferred, TestErrorCode::FIRST, "tile ", ++i, " is missing" );
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Result_Fail_Deferred );
+
+/****************************************/
+/*           TRY Propagation            */
+/****************************************/
+/**
+ * Chain of `DepthT` functions, each propagating the result of the next with
+ * `TERMINUS_OUTCOME_TRY`.  The innermost function fails when asked to.
+ */
+template <int DepthT>
+[[gnu::noinline]] Result<int> try_chain( int i, bool should_fail )
+{
+    if constexpr ( DepthT == 0 )
+    {
+        if( should_fail )
+        {
+            return tmns::outcome::fail( TestErrorCode::SECOND );
+        }
+        return i;
+    }
+    else
+    {
+        TERMINUS_OUTCOME_TRY( auto v, try_chain<DepthT - 1>( i, should_fail ) );
+        return v + 1;
+    }
+}
+
+/**
+ * Propagate through `DepthT` layers.  `range(0)` selects success (0) or failure (1).
+ */
+template <int DepthT>
+static void BM_Result_Try_Depth( benchmark::State& state )
+{
+    const bool should_fail = state.range( 0 ) != 0;
+    int i = 0;
+    for( auto _ : state )
+    {
+        auto r = try_chain<DepthT>( ++i, should_fail );
+        benchmark::DoNotOptimize( r );
+    }
+    state.SetLabel( should_fail ? "fail" : "ok" );
+}
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 1  )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 2  )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 4  )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 8  )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 16 )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( BM_Result_Try_Depth, 32 )->Arg( 0 )->Arg( 1 );
@@ -0,0 +1,135 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_result_batch.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Bulk queries over the outcomes of a 1024x1024 raster with one failure in a thousand, stored as
+ * a `Result_Batch` and as a `std::vector<Result>`.  The `bytes` counter is the storage used.
+ */
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/result_batch.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+using Result = tmns::outcome::Result<float,TestErrorCode>;
+using Batch  = tmns::outcome::Result_Batch<float,TestErrorCode>;
+
+/// Elements of the raster
+constexpr std::size_t cElements = 1024 * 1024;
+
+/// One element in this many fails
+constexpr std::size_t cFailure_Interval = 1000;
+
+Batch make_batch()
+{
+    Batch batch{ cElements };
+    for( std::size_t i = cFailure_Interval / 2; i < cElements; i += cFailure_Interval )
+    {
+        batch.set_error( i, tmns::outcome::Error{ TestErrorCode::FIRST } );
+    }
+    return batch;
+}
+
+std::vector<Result> make_vector()
+{
+    std::vector<Result> results;
+    results.reserve( cElements );
+    for( std::size_t i = 0; i < cElements; ++i )
+    {
+        if( i % cFailure_Interval == cFailure_Interval / 2 )
+        {
+            results.push_back( tmns::outcome::fail( TestErrorCode::FIRST ) );
+        }
+        else
+        {
+            results.push_back( 1.0f );
+        }
+    }
+    return results;
+}
+
+} // End of anonymous namespace
+
+static void BM_Result_Batch_Count_Errors( benchmark::State& state )
+{
+    const auto batch = make_batch();
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( batch.count_errors() );
+    }
+    state.SetItemsProcessed( state.iterations() * cElements );
+    state.counters["bytes"] = static_cast<double>( cElements * sizeof( float ) + cElements / 8 );
+}
+BENCHMARK( BM_Result_Batch_Count_Errors );
+
+static void BM_Vector_Count_Errors( benchmark::State& state )
+{
+    const auto results = make_vector();
+    for( auto _ : state )
+    {
+        std::size_t errors = 0;
+        for( const auto& r : results )
+        {
+            errors += r.has_error();
+        }
+        benchmark::DoNotOptimize( errors );
+    }
+    state.SetItemsProcessed( state.iterations() * cElements );
+    state.counters["bytes"] = static_cast<double>( cElements * sizeof( Result ) );
+}
+BENCHMARK( BM_Vector_Count_Errors );
+
+static void BM_Result_Batch_Compact_Values( benchmark::State& state )
+{
+    const auto batch = make_batch();
+    std::vector<float> out( cElements );
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( batch.compact_values( out ) );
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed( state.iterations() * cElements );
+}
+BENCHMARK( BM_Result_Batch_Compact_Values );
+
+static void BM_Vector_Compact_Values( benchmark::State& state )
+{
+    const auto results = make_vector();
+    std::vector<float> out( cElements );
+    for( auto _ : state )
+    {
+        std::size_t count = 0;
+        for( const auto& r : results )
+        {
+            if( r.has_value() )
+            {
+                out[count++] = r.assume_value();
+            }
+        }
+        benchmark::DoNotOptimize( count );
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed( state.iterations() * cElements );
+}
+BENCHMARK( BM_Vector_Compact_Values );
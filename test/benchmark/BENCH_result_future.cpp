@@ -0,0 +1,293 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_result_future.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Compares `Result_Promise`/`Result_Future` with `std::promise`/`std::future` carrying the same
+ * `Result`, on one thread and handing results across threads at a high task rate.
+ */
+
+// C++ Standard Libraries
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+using Std_Promise    = std::promise<Result<int>>;
+using Result_Promise = tmns::outcome::Result_Promise<int,TestErrorCode>;
+
+void fulfill( Std_Promise& p, int v )
+{
+    p.set_value( Result<int>{ v } );
+}
+
+void fulfill( Result_Promise& p, int v )
+{
+    p.set_value( v );
+}
+
+/**
+ * Single worker thread that fulfills the promises posted to it.  The queue is the same for both
+ * promise types, so the difference between the benchmarks is the promise and future.
+ */
+template <class PromiseT>
+class Worker
+{
+    public:
+
+        Worker()
+          : m_thread{ [this] { run(); } }
+        {}
+
+        ~Worker()
+        {
+            {
+                std::lock_guard lock{ m_mutex };
+                m_stop = true;
+            }
+            m_cv.notify_one();
+            m_thread.join();
+        }
+
+        void post( std::vector<PromiseT>& batch )
+        {
+            {
+                std::lock_guard lock{ m_mutex };
+                for( auto& p : batch )
+                {
+                    m_queue.push_back( std::move( p ) );
+                }
+            }
+            m_cv.notify_one();
+        }
+
+    private:
+
+        void run()
+        {
+            std::unique_lock lock{ m_mutex };
+            while( true )
+            {
+                m_cv.wait( lock, [this] { return m_stop || !m_queue.empty(); } );
+                if( m_queue.empty() )
+                {
+                    return;
+                }
+                auto work = std::move( m_queue );
+                m_queue.clear();
+                lock.unlock();
+                int i = 0;
+                for( auto& p : work )
+                {
+                    fulfill( p, i++ );
+                }
+                lock.lock();
+            }
+        }
+
+        std::mutex              m_mutex;
+        std::condition_variable m_cv;
+        std::deque<PromiseT>    m_queue;
+        bool                    m_stop{ false };
+        std::thread             m_thread;
+};
+
+} // End of anonymous namespace
+
+/****************************************/
+/*            Same Thread               */
+/****************************************/
+/**
+ * `std::promise` set and read on one thread.
+ */
+static void BM_Future_Std_Round_Trip( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        Std_Promise p;
+        auto f = p.get_future();
+        fulfill( p, 1 );
+        auto r = f.get();
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Future_Std_Round_Trip );
+
+/**
+ * `Result_Promise` with its state on the default heap.
+ */
+static void BM_Future_Result_Round_Trip( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        Result_Promise p;
+        auto f = p.get_future();
+        fulfill( p, 1 );
+        auto r = f.get();
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Future_Result_Round_Trip );
+
+/**
+ * `Result_Promise` with its state from a pool resource.
+ */
+static void BM_Future_Result_Pool_Round_Trip( benchmark::State& state )
+{
+    std::pmr::unsynchronized_pool_resource pool;
+    for( auto _ : state )
+    {
+        Result_Promise p{ &pool };
+        auto f = p.get_future();
+        fulfill( p, 1 );
+        auto r = f.get();
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Future_Result_Pool_Round_Trip );
+
+/**
+ * `Result_Promise` with its state inline in a `Result_Slot`.
+ */
+static void BM_Future_Result_Slot_Round_Trip( benchmark::State& state )
+{
+    for( auto _ : state )
+    {
+        tmns::outcome::Result_Slot<int,TestErrorCode> slot;
+        auto p = slot.get_promise();
+        auto f = p.get_future();
+        fulfill( p, 1 );
+        auto r = f.get();
+        benchmark::DoNotOptimize( r );
+    }
+}
+BENCHMARK( BM_Future_Result_Slot_Round_Trip );
+
+/****************************************/
+/*            Cross Thread              */
+/****************************************/
+/**
+ * Post `range(0)` promises to a worker thread and wait for all of their results.
+ */
+template <class PromiseT>
+static void cross_thread( benchmark::State& state, std::pmr::memory_resource* resource )
+{
+    const auto batch_size = static_cast<std::size_t>( state.range( 0 ) );
+    Worker<PromiseT> worker;
+    std::vector<PromiseT> batch;
+    std::vector<decltype( std::declval<PromiseT&>().get_future() )> futures;
+    batch.reserve( batch_size );
+    futures.reserve( batch_size );
+
+    for( auto _ : state )
+    {
+        for( std::size_t i = 0; i < batch_size; ++i )
+        {
+            if constexpr ( std::is_same_v<PromiseT, Std_Promise> )
+            {
+                batch.emplace_back();
+            }
+            else
+            {
+                batch.emplace_back( resource );
+            }
+            futures.push_back( batch.back().get_future() );
+        }
+        worker.post( batch );
+        batch.clear();
+        for( auto& f : futures )
+        {
+            auto r = f.get();
+            benchmark::DoNotOptimize( r );
+        }
+        futures.clear();
+    }
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+static void BM_Future_Std_Cross_Thread( benchmark::State& state )
+{
+    cross_thread<Std_Promise>( state, nullptr );
+}
+BENCHMARK( BM_Future_Std_Cross_Thread )->Arg( 1 )->Arg( 64 )->Arg( 1024 )->UseRealTime();
+
+static void BM_Future_Result_Cross_Thread( benchmark::State& state )
+{
+    cross_thread<Result_Promise>( state, std::pmr::get_default_resource() );
+}
+BENCHMARK( BM_Future_Result_Cross_Thread )->Arg( 1 )->Arg( 64 )->Arg( 1024 )->UseRealTime();
+
+static void BM_Future_Result_Pool_Cross_Thread( benchmark::State& state )
+{
+    std::pmr::synchronized_pool_resource pool;
+    cross_thread<Result_Promise>( state, &pool );
+}
+BENCHMARK( BM_Future_Result_Pool_Cross_Thread )->Arg( 1 )->Arg( 64 )->Arg( 1024 )->UseRealTime();
+
+/****************************************/
+/*            Continuations             */
+/****************************************/
+/**
+ * Attach a `then`/`on_error`/`finally` chain to `range(0)` pending futures, then complete them
+ * all from one thread.  No thread blocks while the operations are in flight.
+ */
+static void BM_Future_Result_Then_Chain( benchmark::State& state )
+{
+    const auto in_flight = static_cast<std::size_t>( state.range( 0 ) );
+    std::pmr::unsynchronized_pool_resource pool;
+    std::vector<Result_Promise> promises;
+    std::vector<tmns::outcome::Result_Future<int,TestErrorCode>> futures;
+    promises.reserve( in_flight );
+    futures.reserve( in_flight );
+    int completed = 0;
+
+    for( auto _ : state )
+    {
+        for( std::size_t i = 0; i < in_flight; ++i )
+        {
+            promises.emplace_back( &pool );
+            futures.push_back( promises.back().get_future()
+                                   .then( []( int v ) { return v + 1; } )
+                                   .on_error( []( const tmns::outcome::Error<TestErrorCode>& ) { return 0; } )
+                                   .finally( [&completed] { ++completed; } ) );
+        }
+        int i = 0;
+        for( auto& p : promises )
+        {
+            fulfill( p, i++ );
+        }
+        promises.clear();
+        futures.clear();
+    }
+    benchmark::DoNotOptimize( completed );
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+BENCHMARK( BM_Future_Result_Then_Chain )->Arg( 1 )->Arg( 1024 );
@@ -0,0 +1,115 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_thread_pool.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Scaling of `Thread_Pool` from one worker to one per core, for jobs of a few microseconds and
+ * for empty jobs, which measure the cost of the pool itself.
+ */
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/future_combinators.hpp>
+#include <terminus/outcome/result_future.hpp>
+#include <terminus/outcome/thread_pool.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+/// Jobs per iteration
+constexpr int cBatch_Size = 1024;
+
+/**
+ * @brief Stand-in for a tile job: `rounds` steps of a xorshift generator.
+ */
+Result<std::uint64_t> tile_job( std::uint64_t seed, int rounds )
+{
+    auto x = seed | 1;
+    for( int i = 0; i < rounds; ++i )
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+/**
+ * @brief Worker counts from one to the number of cores, doubling.
+ */
+void worker_counts( benchmark::internal::Benchmark* b )
+{
+    const auto cores = static_cast<int>( std::max( 1u, std::thread::hardware_concurrency() ) );
+    for( int n = 1; n < cores; n *= 2 )
+    {
+        b->Arg( n );
+    }
+    b->Arg( cores );
+}
+
+} // End of anonymous namespace
+
+/**
+ * Submit a batch of jobs with `rounds` of work each, and collect them with `when_all()`.
+ */
+static void run_batches( benchmark::State& state, int rounds )
+{
+    std::pmr::synchronized_pool_resource resource;
+    tmns::outcome::Thread_Pool pool{ static_cast<std::size_t>( state.range( 0 ) ), &resource };
+    std::vector<tmns::outcome::Result_Future<std::uint64_t,TestErrorCode>> futures;
+    futures.reserve( cBatch_Size );
+
+    for( auto _ : state )
+    {
+        for( int i = 0; i < cBatch_Size; ++i )
+        {
+            futures.push_back( pool.submit( [i, rounds] { return tile_job( i, rounds ); } ) );
+        }
+        auto r = tmns::outcome::when_all( std::move( futures ) ).get();
+        benchmark::DoNotOptimize( r );
+        futures.clear();
+    }
+    state.SetItemsProcessed( state.iterations() * cBatch_Size );
+}
+
+/**
+ * Jobs of roughly two microseconds.
+ */
+static void BM_Thread_Pool_Scaling( benchmark::State& state )
+{
+    run_batches( state, 2000 );
+}
+BENCHMARK( BM_Thread_Pool_Scaling )->Apply( worker_counts )->UseRealTime();
+
+/**
+ * Empty jobs, so the time is spent in the pool and the futures.
+ */
+static void BM_Thread_Pool_Overhead( benchmark::State& state )
+{
+    run_batches( state, 0 );
+}
+BENCHMARK( BM_Thread_Pool_Overhead )->Apply( worker_counts )->UseRealTime();
@@ -0,0 +1,93 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    BENCH_wire.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Encoding a failed tile result for the coordinator, in the binary wire format and as JSON,
+ * against flattening it to `Error::message()`, and decoding it back.
+ */
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Google Benchmark Libraries
+#include <benchmark/benchmark.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/json.hpp>
+#include <terminus/outcome/wire.hpp>
+
+namespace {
+
+using tmns::core::error::Error_Code;
+using Result = tmns::outcome::Result<int,Error_Code>;
+
+Result make_failure()
+{
+    return tmns::outcome::fail( Error_Code::FILE_NOT_FOUND, "tile 1432/877 missing from /data/mosaic/z12" );
+}
+
+} // End of anonymous namespace
+
+static void BM_Wire_Encode( benchmark::State& state )
+{
+    const auto result = make_failure();
+    std::vector<std::byte> buffer;
+    for( auto _ : state )
+    {
+        buffer.clear();
+        tmns::outcome::encode( buffer, result );
+        benchmark::DoNotOptimize( buffer.data() );
+    }
+    state.counters["bytes"] = static_cast<double>( buffer.size() );
+}
+BENCHMARK( BM_Wire_Encode );
+
+static void BM_Wire_Decode( benchmark::State& state )
+{
+    std::vector<std::byte> buffer;
+    tmns::outcome::encode( buffer, make_failure() );
+    for( auto _ : state )
+    {
+        tmns::outcome::Wire_Reader reader{ buffer };
+        benchmark::DoNotOptimize( reader.read_result<int>() );
+    }
+}
+BENCHMARK( BM_Wire_Decode );
+
+static void BM_Json_Write( benchmark::State& state )
+{
+    const auto result = make_failure();
+    std::string buffer;
+    for( auto _ : state )
+    {
+        buffer.clear();
+        tmns::outcome::write_json( buffer, result );
+        benchmark::DoNotOptimize( buffer.data() );
+    }
+    state.counters["bytes"] = static_cast<double>( buffer.size() );
+}
+BENCHMARK( BM_Json_Write );
+
+static void BM_Message_Flatten( benchmark::State& state )
+{
+    const auto result = make_failure();
+    for( auto _ : state )
+    {
+        benchmark::DoNotOptimize( result.error().message() );
+    }
+}
+BENCHMARK( BM_Message_Flatten );
@@ -0,0 +1,79 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    COMPILE_outcome.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Translation unit timed by the `compile_time` target to compare the cost of including and
+ * instantiating the library under the Boost and standard library backends, with the
+ * `extern template` instantiations, and through the `terminus.outcome` module.
+ */
+
+// C++ Standard Libraries
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#if defined( TERMINUS_OUTCOME_COMPILE_TIME_MODULE )
+import terminus.outcome;
+#include <terminus/outcome/macros.hpp>
+#else
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#endif
+
+namespace bench {
+
+using tmns::core::error::Error_Code;
+using tmns::outcome::Optional;
+
+Result<int> parse( int v )
+{
+    if( v < 0 )
+    {
+        return tmns::outcome::fail( Error_Code::INVALID_INPUT, "negative" );
+    }
+    return tmns::outcome::ok<int>( v );
+}
+
+Result<std::string> name( int v )
+{
+    TERMINUS_OUTCOME_TRY( auto n, parse( v ) );
+    return tmns::outcome::ok<std::string>( std::to_string( n ) );
+}
+
+Result<std::vector<int>> many( int v )
+{
+    TERMINUS_OUTCOME_TRY( auto n, parse( v ) );
+    return tmns::outcome::ok<std::vector<int>>( static_cast<std::size_t>( n ), n );
+}
+
+Result<void> check( int v )
+{
+    TERMINUS_OUTCOME_TRY( parse( v ) );
+    return tmns::outcome::ok();
+}
+
+Result<const std::string&> ref( const std::string& s )
+{
+    return s;
+}
+
+Optional<std::string> maybe( int v )
+{
+    if( v < 0 )
+    {
+        return tmns::outcome::cEmpty;
+    }
+    return std::to_string( v );
+}
+
+} // End of bench namespace
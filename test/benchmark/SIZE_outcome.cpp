@@ -0,0 +1,92 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    SIZE_outcome.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Program linked by the `binary_size` target with and without exceptions, to compare the size of
+ * code that uses `Result`, `Optional` and `panic()` in each mode.
+ */
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS ) && defined( BOOST_NO_EXCEPTIONS )
+TERMINUS_OUTCOME_DEFINE_BOOST_THROW_EXCEPTION()
+#endif
+
+namespace size {
+
+using tmns::core::error::Error_Code;
+using tmns::outcome::Optional;
+
+Result<int> parse( const std::string& text )
+{
+    if( text.empty() || text.size() > 9 )
+    {
+        return tmns::outcome::fail( Error_Code::INVALID_INPUT, "bad length ", text.size() );
+    }
+    int v = 0;
+    for( const char c : text )
+    {
+        if( c < '0' || c > '9' )
+        {
+            return tmns::outcome::fail( Error_Code::INVALID_INPUT, "bad digit in ", text );
+        }
+        v = v * 10 + ( c - '0' );
+    }
+    return tmns::outcome::ok<int>( v );
+}
+
+Result<std::vector<int>> parse_all( const std::vector<std::string>& texts )
+{
+    std::vector<int> out;
+    for( const auto& text : texts )
+    {
+        TERMINUS_OUTCOME_TRY( auto v, parse( text ) );
+        out.push_back( v );
+    }
+    return tmns::outcome::ok<std::vector<int>>( std::move( out ) );
+}
+
+Optional<std::string> label( int v )
+{
+    if( v < 0 )
+    {
+        return tmns::outcome::cEmpty;
+    }
+    return std::to_string( v );
+}
+
+} // End of size namespace
+
+int main( int argc, char* argv[] )
+{
+    std::vector<std::string> texts( argv + 1, argv + argc );
+    const auto values = size::parse_all( texts );
+    if( texts.size() > 3 )
+    {
+        tmns::outcome::panic( tmns::core::error::Error_Code::INVALID_INPUT, "too many inputs" );
+    }
+    int total = 0;
+    for( const int v : values.value() )
+    {
+        total += v;
+    }
+    std::printf( "%s\n", size::label( total ).value().c_str() );
+    return 0;
+}
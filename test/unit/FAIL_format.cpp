@@ -0,0 +1,42 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    FAIL_format.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Checks that `fail( cFormat, ... )` rejects a bad format string at compile time.  Built twice by
+ * `test/unit/CMakeLists.txt`: as is it must compile, and with `TERMINUS_OUTCOME_TEST_BAD_FORMAT`
+ * defined it must not.  The two builds differ only in the format string.
+*/
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/format.hpp>
+
+#if defined( TERMINUS_OUTCOME_TEST_BAD_FORMAT )
+    #define TERMINUS_OUTCOME_TEST_FORMAT "tile {} of {}"
+#else
+    #define TERMINUS_OUTCOME_TEST_FORMAT "tile {}"
+#endif
+
+tmns::outcome::Result<int,tmns::core::error::Error_Code> load_tile( int tile )
+{
+    return tmns::outcome::fail( tmns::outcome::cFormat,
+                                tmns::core::error::Error_Code::NOT_FOUND,
+                                TERMINUS_OUTCOME_TEST_FORMAT,
+                                tile );
+}
+
+int main()
+{
+    return load_tile( 7 ).has_failure() ? 0 : 1;
+}
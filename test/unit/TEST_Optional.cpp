@@ -14,8 +14,12 @@
  */
 
 // C++ Standard Libraries
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
+#include <type_traits>
 
 // GoogleTest Libraries
 #include <gtest/gtest.h>
@@ -23,6 +27,20 @@
 // Terminus Libraries
 #include <terminus/outcome.hpp>
 
+enum class Tile_Id : std::uint32_t { FIRST = 0, INVALID = 0xFFFFFFFF };
+
+template <>
+struct tmns::outcome::Optional_Niche<Tile_Id> : tmns::outcome::Optional_Sentinel<Tile_Id,Tile_Id::INVALID> {};
+
+/**
+ * @brief Trivially copyable type without a niche.
+ */
+struct Sample
+{
+    float x;
+    float y;
+};
+
 /********************************************/
 /*          Test the Optional Class         */
 /********************************************/
@@ -114,7 +132,16 @@ TEST( Optional, MoveAssignFromStandard )
     EXPECT_TRUE( stdopt->empty() );
 
     stdopt.reset();
+    // GCC 12 at -O1 and above reports a false -Wmaybe-uninitialized for the string in the empty
+    // `stdopt`, which std::optional's move assignment never reads
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
     opt = std::move( stdopt );
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC diagnostic pop
+#endif
     EXPECT_FALSE( opt.has_value() );
 }
 
@@ -138,4 +165,95 @@ TEST( Optional, MoveConvertToStandard )
     std::optional<std::string> stdopt = std::move( opt );
     EXPECT_EQ( stdopt.value(), "Hello World" );
     EXPECT_TRUE( opt.value().empty() );
-}
\ No newline at end of file
+}
+
+/********************************************/
+/*        Test the Inline Optional          */
+/********************************************/
+/**
+ * @test Pointers, floating point numbers and types with a sentinel take no space for the flag
+ *       and give a trivially copyable optional.  Other trivially copyable values keep the
+ *       backend's optional, which is only trivially copyable with the std backend.
+ */
+TEST( Optional, Niche_Layout )
+{
+    static_assert( sizeof( tmns::outcome::Optional<double> ) == sizeof( double ) );
+    static_assert( sizeof( tmns::outcome::Optional<float> ) == sizeof( float ) );
+    static_assert( sizeof( tmns::outcome::Optional<const int*> ) == sizeof( int* ) );
+    static_assert( sizeof( tmns::outcome::Optional<Tile_Id> ) == sizeof( Tile_Id ) );
+
+    static_assert( std::is_trivially_copyable_v<tmns::outcome::Optional<double>> );
+    static_assert( std::is_trivially_copyable_v<tmns::outcome::Optional<Tile_Id>> );
+#if defined( TERMINUS_OUTCOME_USE_STD_BACKEND )
+    static_assert( sizeof( tmns::outcome::Optional<Sample> ) == sizeof( std::optional<Sample> ) );
+    static_assert( std::is_trivially_copyable_v<tmns::outcome::Optional<Sample>> );
+    static_assert( std::is_trivially_copyable_v<tmns::outcome::Optional<int>> );
+#endif
+
+    static_assert( !tmns::outcome::Optional<double>{}.has_value() );
+    static_assert( tmns::outcome::Optional<double>{ 2.5 }.value() == 2.5 );
+    EXPECT_EQ( sizeof( tmns::outcome::Optional<double> ), sizeof( double ) );
+}
+
+/**
+ * @test The niche value reads as empty; every other value, including other NaNs, is kept.
+ */
+TEST( Optional, Niche_Values )
+{
+    int v = 3;
+    tmns::outcome::Optional<int*> p{ &v };
+    ASSERT_TRUE( p );
+    EXPECT_EQ( **p, 3 );
+    p = nullptr;
+    EXPECT_FALSE( p.has_value() );
+    EXPECT_EQ( p.get_ptr(), nullptr );
+
+    tmns::outcome::Optional<double> d{ std::numeric_limits<double>::quiet_NaN() };
+    ASSERT_TRUE( d.has_value() );
+    EXPECT_TRUE( std::isnan( *d ) );
+    d = tmns::outcome::cEmpty;
+    EXPECT_FALSE( d );
+    EXPECT_EQ( d.value_or( 1.5 ), 1.5 );
+#if !defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    EXPECT_THROW( (void)d.value(), std::exception );
+#endif
+    d.emplace( -0.0 );
+    EXPECT_TRUE( d.has_value() );
+    EXPECT_TRUE( std::signbit( d.value() ) );
+
+    tmns::outcome::Optional<Tile_Id> t{ Tile_Id::FIRST };
+    EXPECT_EQ( t, Tile_Id::FIRST );
+    t = Tile_Id::INVALID;
+    EXPECT_EQ( t, tmns::outcome::cEmpty );
+    t.emplace( Tile_Id::FIRST );
+    EXPECT_EQ( t.transform( []( Tile_Id id ){ return static_cast<int>( id ) + 1; } ).value_or( 0 ), 1 );
+
+    tmns::outcome::Optional<Sample> s;
+    EXPECT_FALSE( s );
+    s = Sample{ 1.0f, 2.0f };
+    EXPECT_EQ( s->y, 2.0f );
+    s.reset();
+    EXPECT_FALSE( s.has_value() );
+}
+
+/**
+ * @test Inline optionals bridge to and from `std::optional` like the others.
+ */
+TEST( Optional, Niche_Standard_Bridge )
+{
+    std::optional<double> stdopt{ 0.5 };
+    tmns::outcome::Optional<double> opt{ stdopt };
+    EXPECT_EQ( opt.value(), 0.5 );
+
+    stdopt.reset();
+    opt = stdopt;
+    EXPECT_FALSE( opt.has_value() );
+
+    opt = 4.0;
+    std::optional<double> back = opt;
+    EXPECT_EQ( back.value(), 4.0 );
+
+    tmns::outcome::Optional<Tile_Id> empty;
+    std::optional<Tile_Id> empty_back = empty;
+    EXPECT_FALSE( empty_back.has_value() );
+}
@@ -0,0 +1,231 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_algorithms.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/algorithms.hpp>
+#include <terminus/outcome/thread_pool.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+namespace {
+
+/**
+ * @brief Inputs `0` to `count - 1`.
+ */
+std::vector<int> iota( int count )
+{
+    std::vector<int> inputs( count );
+    std::iota( inputs.begin(), inputs.end(), 0 );
+    return inputs;
+}
+
+} // End of anonymous namespace
+
+/****************************************************/
+/*           Test the transform_results API         */
+/****************************************************/
+/**
+ * @test Values are gathered in input order under a policy and on a pool.
+ */
+TEST( Algorithms, TransformResults )
+{
+    const auto inputs = iota( 1000 );
+    auto twice = []( int v ) { return Result<int>{ v * 2 }; };
+
+    auto r = tmns::outcome::transform_results( std::execution::par, inputs, twice );
+    ASSERT_TRUE( r.has_value() );
+    ASSERT_EQ( r.assume_value().size(), 1000u );
+    EXPECT_EQ( r.assume_value()[999], 1998 );
+
+    tmns::outcome::Thread_Pool pool{ 4 };
+    auto p = tmns::outcome::transform_results( pool, inputs, twice );
+    ASSERT_TRUE( p.has_value() );
+    for( int i = 0; i < 1000; ++i )
+    {
+        EXPECT_EQ( p.assume_value()[i], i * 2 );
+    }
+
+    auto empty = tmns::outcome::transform_results( std::execution::seq, std::vector<int>{}, twice );
+    EXPECT_TRUE( empty.has_value() && empty.assume_value().empty() );
+}
+
+/**
+ * @test The error at the lowest failing index wins, and later inputs are skipped.
+ */
+TEST( Algorithms, LowestIndexWins )
+{
+    const auto inputs = iota( 10000 );
+    tmns::outcome::Thread_Pool pool{ 4 };
+    for( int round = 0; round < 20; ++round )
+    {
+        std::atomic<int> ran{ 0 };
+        auto fn = [&]( int v ) -> Result<std::string> {
+            ++ran;
+            if( v == 5000 )
+            {
+                return tmns::outcome::fail( TestErrorCode::SECOND );
+            }
+            if( v == 3000 || v == 7000 )
+            {
+                return tmns::outcome::fail( TestErrorCode::FIRST, "input ", v );
+            }
+            return tmns::outcome::ok<std::string>( std::to_string( v ) );
+        };
+        auto r = tmns::outcome::transform_results( pool, inputs, fn );
+        ASSERT_TRUE( r.has_error() );
+        EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+        EXPECT_EQ( r.assume_error().details(), "input 3000" );
+    }
+
+    auto u = tmns::outcome::try_for_each( std::execution::par_unseq, inputs, []( int v ) -> Result<void> {
+        if( v % 1000 == 999 )
+        {
+            return tmns::outcome::fail( TestErrorCode::FIRST, v );
+        }
+        return tmns::outcome::ok();
+    } );
+    EXPECT_EQ( u.assume_error().details(), "999" );
+
+    std::atomic<int> ran{ 0 };
+    auto r = tmns::outcome::try_for_each( std::execution::seq, inputs, [&]( int v ) -> Result<void> {
+        ++ran;
+        if( v == 10 )
+        {
+            return tmns::outcome::fail( TestErrorCode::SECOND );
+        }
+        return tmns::outcome::ok();
+    } );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_EQ( ran.load(), 11 );
+}
+
+/****************************************************/
+/*       Test the collect and try_for_each APIs     */
+/****************************************************/
+/**
+ * @test `collect()` keeps every outcome, and `try_for_each()` visits every input on success.
+ */
+TEST( Algorithms, CollectAndTryForEach )
+{
+    const auto inputs = iota( 100 );
+    tmns::outcome::Thread_Pool pool{ 3 };
+
+    auto results = tmns::outcome::collect( pool, inputs, []( int v ) -> Result<int> {
+        if( v % 10 == 0 )
+        {
+            return tmns::outcome::fail( TestErrorCode::FIRST );
+        }
+        return v;
+    } );
+    ASSERT_EQ( results.size(), 100u );
+    for( int i = 0; i < 100; ++i )
+    {
+        EXPECT_EQ( results[i].has_error(), i % 10 == 0 );
+    }
+
+    std::atomic<int> sum{ 0 };
+    auto r = tmns::outcome::try_for_each( std::execution::par_unseq, inputs, [&]( int v ) {
+        sum += v;
+        return Result<void>{ tmns::outcome::ok() };
+    } );
+    EXPECT_TRUE( r.has_value() );
+    EXPECT_EQ( sum.load(), 4950 );
+}
+
+/**
+ * @test Algorithms called from a pool's own worker complete.
+ */
+TEST( Algorithms, NestedInPool )
+{
+    tmns::outcome::Thread_Pool pool{ 1 };
+    auto outer = pool.submit( [&] {
+        return tmns::outcome::transform_results( pool, iota( 64 ), []( int v ) { return Result<int>{ v }; } );
+    } );
+    EXPECT_EQ( outer.get().assume_value().size(), 64u );
+}
+
+#if defined( __cpp_exceptions )
+/**
+ * @test An exception from the element function on a pool reaches the caller only after the
+ *       other chunks are done with the caller's state, and the pool stays usable.
+ */
+TEST( Algorithms, ThrowingFunctionOnPool )
+{
+    tmns::outcome::Thread_Pool pool{ 4 };
+    std::atomic<int> calls{ 0 };
+    auto fn = [&]( int v ) -> Result<int> {
+        calls.fetch_add( 1, std::memory_order_relaxed );
+        if( v == 0 )
+        {
+            throw std::runtime_error( "element 0" );
+        }
+        std::this_thread::sleep_for( std::chrono::microseconds( 200 ) );
+        return v;
+    };
+    EXPECT_THROW( tmns::outcome::transform_results( pool, iota( 256 ), fn ), std::runtime_error );
+    EXPECT_LT( calls.load(), 256 );
+
+    auto r = tmns::outcome::transform_results( pool, iota( 16 ), []( int v ) { return Result<int>{ v }; } );
+    EXPECT_EQ( r.assume_value().size(), 16u );
+}
+#endif
+
+/****************************************************/
+/*      Test the transform_reduce_results API       */
+/****************************************************/
+/**
+ * @test Values are reduced in input order, and errors stop the reduction.
+ */
+TEST( Algorithms, TransformReduceResults )
+{
+    const auto inputs = iota( 26 );
+    tmns::outcome::Thread_Pool pool{ 4 };
+    auto letter = []( int v ) { return Result<std::string>{ tmns::outcome::ok<std::string>( 1, static_cast<char>( 'a' + v ) ) }; };
+    auto concat = []( std::string a, std::string b ) { return a + b; };
+
+    auto r = tmns::outcome::transform_reduce_results( pool, inputs, std::string{ ">" }, concat, letter );
+    EXPECT_EQ( r.assume_value(), ">abcdefghijklmnopqrstuvwxyz" );
+
+    auto sum = tmns::outcome::transform_reduce_results( std::execution::par, iota( 1000 ), 0L, std::plus<>{},
+                                                        []( int v ) { return Result<long>{ v }; } );
+    EXPECT_EQ( sum.assume_value(), 499500L );
+
+    auto failed = tmns::outcome::transform_reduce_results( pool, inputs, 0, std::plus<>{}, []( int v ) -> Result<int> {
+        if( v > 20 )
+        {
+            return tmns::outcome::fail( TestErrorCode::SECOND );
+        }
+        return v;
+    } );
+    EXPECT_EQ( failed.assume_error().code(), TestErrorCode::SECOND );
+}
@@ -0,0 +1,301 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_coroutine.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <string>
+#include <thread>
+#include <utility>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/coroutine.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+template <class ValueT>
+using Task = tmns::outcome::Task<Result<ValueT>>;
+
+using tmns::outcome::fail;
+using tmns::outcome::ok;
+
+namespace {
+
+Result<int> parse( int v )
+{
+    if( v < 0 )
+    {
+        return fail( TestErrorCode::FIRST, "negative" );
+    }
+    return ok<int>( v );
+}
+
+Result<std::string> describe( int a, int b, int& steps )
+{
+    auto sum = co_await parse( a ) + co_await parse( b );
+    ++steps;
+    co_return std::to_string( sum );
+}
+
+Task<int> read_value( int v )
+{
+    co_return co_await parse( v );
+}
+
+Task<int> add_values( int a, int b, int& resumed )
+{
+    auto x = co_await read_value( a );
+    ++resumed;
+    auto y = co_await read_value( b );
+    ++resumed;
+    co_return x + y;
+}
+
+Task<int> nested_depth( int depth )
+{
+    if( depth == 0 )
+    {
+        co_return 0;
+    }
+    co_return 1 + co_await nested_depth( depth - 1 );
+}
+
+Task<int> nested_failure( int depth, int& resumed )
+{
+    if( depth == 0 )
+    {
+        co_return co_await parse( -1 );
+    }
+    auto v = co_await nested_failure( depth - 1, resumed );
+    ++resumed;
+    co_return v;
+}
+
+} // End of anonymous namespace
+
+/****************************************************/
+/*          Test Coroutines Returning Result        */
+/****************************************************/
+/**
+ * @test `co_await` yields the values of successful results.
+ */
+TEST( Result_Coroutine, Success )
+{
+    int steps = 0;
+    auto r = describe( 2, 3, steps );
+    ASSERT_TRUE( r.has_value() );
+    EXPECT_EQ( r.assume_value(), "5" );
+    EXPECT_EQ( steps, 1 );
+}
+
+/**
+ * @test `co_await` on a failed result returns its error without running the rest of the body.
+ */
+TEST( Result_Coroutine, Failure )
+{
+    int steps = 0;
+    auto r = describe( 2, -1, steps );
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+    EXPECT_EQ( r.assume_error().details(), "negative" );
+    EXPECT_EQ( steps, 0 );
+}
+
+/**
+ * @test Lvalue results, reference results and `Result<void>` are supported.
+ */
+TEST( Result_Coroutine, References )
+{
+    int value = 4;
+    auto get_ref = [&]() -> Result<int&> { return value; };
+    auto check   = [&]() -> Result<void> {
+        Result<std::string> s = ok<std::string>( "kept" );
+        const std::string& view = co_await s;
+        EXPECT_EQ( &view, &s.assume_value() );
+
+        int& ref = co_await get_ref();
+        EXPECT_EQ( &ref, &value );
+        ref = 5;
+        co_return ok();
+    };
+    EXPECT_TRUE( check().has_value() );
+    EXPECT_EQ( value, 5 );
+
+    auto failing = []() -> Result<void> {
+        co_await Result<void>{ fail( TestErrorCode::SECOND ) };
+        co_return ok();
+    };
+    EXPECT_EQ( failing().assume_error().code(), TestErrorCode::SECOND );
+}
+
+/**
+ * @test `co_return` accepts a failure.
+ */
+TEST( Result_Coroutine, ReturnFailure )
+{
+    auto f = []( bool bad ) -> Result<int> {
+        if( bad )
+        {
+            co_return fail( TestErrorCode::SECOND, "bad" );
+        }
+        co_return 1;
+    };
+    EXPECT_EQ( f( false ).assume_value(), 1 );
+    EXPECT_EQ( f( true ).assume_error().code(), TestErrorCode::SECOND );
+}
+
+/****************************************************/
+/*                Test the Task Class               */
+/****************************************************/
+/**
+ * @test A task does nothing until it is started.
+ */
+TEST( Task, Lazy )
+{
+    bool ran = false;
+    auto make = [&]() -> Task<void> {
+        ran = true;
+        co_return ok();
+    };
+    {
+        auto task = make();
+        EXPECT_TRUE( task.valid() );
+        EXPECT_FALSE( ran );
+    }
+    EXPECT_FALSE( ran );
+
+    EXPECT_TRUE( make().start().get().has_value() );
+    EXPECT_TRUE( ran );
+}
+
+/**
+ * @test Awaited tasks produce their values.
+ */
+TEST( Task, Nested )
+{
+    int resumed = 0;
+    auto r = add_values( 20, 22, resumed ).start().get();
+    ASSERT_TRUE( r.has_value() );
+    EXPECT_EQ( r.assume_value(), 42 );
+    EXPECT_EQ( resumed, 2 );
+}
+
+/**
+ * @test A failure finishes every awaiting task without resuming it.
+ */
+TEST( Task, FailurePropagates )
+{
+    int resumed = 0;
+    auto outer = [&]() -> Task<std::string> {
+        auto v = co_await add_values( 1, -1, resumed );
+        ++resumed;
+        co_return std::to_string( v );
+    };
+    auto r = outer().start().get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+    EXPECT_EQ( resumed, 1 );
+}
+
+/**
+ * @test `as_result()` produces the whole result of a task.
+ */
+TEST( Task, AsResult )
+{
+    auto outer = []() -> Task<int> {
+        auto r = co_await tmns::outcome::as_result( read_value( -1 ) );
+        EXPECT_TRUE( r.has_error() );
+        co_return r.has_error() ? 7 : 0;
+    };
+    EXPECT_EQ( outer().start().get().assume_value(), 7 );
+}
+
+/**
+ * @test A task awaiting a future suspends until another thread stores the result.
+ */
+TEST( Task, AwaitFuture )
+{
+    tmns::outcome::Result_Promise<int,TestErrorCode> value_promise;
+    tmns::outcome::Result_Promise<int,TestErrorCode> error_promise;
+    auto task = []( tmns::outcome::Result_Future<int,TestErrorCode> a,
+                    tmns::outcome::Result_Future<int,TestErrorCode> b,
+                    int& resumed ) -> Task<int>
+    {
+        auto x = co_await std::move( a );
+        ++resumed;
+        auto y = co_await std::move( b );
+        ++resumed;
+        co_return x + y;
+    };
+
+    int resumed = 0;
+    auto future = task( value_promise.get_future(), error_promise.get_future(), resumed ).start();
+    EXPECT_FALSE( future.is_ready() );
+
+    std::thread producer( [&] {
+        value_promise.set_value( 1 );
+        error_promise.set_error( tmns::outcome::Error{ TestErrorCode::SECOND } );
+    } );
+    auto r = future.get();
+    producer.join();
+
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_EQ( resumed, 1 );
+}
+
+/**
+ * @test Many synchronously completing tasks awaited in a loop use no more stack than one.
+ */
+TEST( Task, SequentialAwaits )
+{
+    auto loop = []( int count ) -> Task<int> {
+        int total = 0;
+        for( int i = 0; i < count; ++i )
+        {
+            total += co_await read_value( 1 );
+        }
+        co_return total;
+    };
+    EXPECT_EQ( loop( 100000 ).start().get().assume_value(), 100000 );
+}
+
+/**
+ * @test A deep chain of tasks, each awaiting the next, uses no more stack than one.
+ */
+TEST( Task, DeepNestedAwaits )
+{
+    EXPECT_EQ( nested_depth( 100000 ).start().get().assume_value(), 100000 );
+}
+
+/**
+ * @test A failure at the bottom of a deep chain of tasks finishes the outermost one without
+ *       resuming the others.
+ */
+TEST( Task, DeepNestedFailure )
+{
+    int resumed = 0;
+    auto r = nested_failure( 100000, resumed ).start().get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+    EXPECT_EQ( resumed, 0 );
+}
@@ -14,6 +14,12 @@
  * @date    7/8/2023
  */
 
+// C++ Standard Libraries
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 // GoogleTest Libraries
 #include <gtest/gtest.h>
 
@@ -33,7 +39,7 @@ TEST( Error, Get_String_Message )
 {
     tmns::outcome::Error a { TestErrorCode::FIRST, "message number ", 42 };
     EXPECT_EQ( a.code(), TestErrorCode::FIRST );
-    EXPECT_EQ( a.code().category().name(), "TestError" );
+    EXPECT_STREQ( a.code().category().name(), "TestError" );
     EXPECT_EQ( a.details(), "message number 42" );
 
     tmns::outcome::Error b { TestErrorCode::SUCCESS };
@@ -51,4 +57,216 @@ TEST( Error, Get_String_Message_For_Invalid_Code )
 {
     tmns::outcome::Error a { static_cast<TestErrorCode>(3) };
     EXPECT_EQ( a.message(), "unknown" );
-}
\ No newline at end of file
+}
+
+/**
+ * @test Deferred errors render the same details and message as eagerly formatted errors.
+ */
+TEST( Error, Deferred_Matches_Eager )
+{
+    tmns::outcome::Error eager { TestErrorCode::SECOND, "value ", 42, " of ", 3.5 };
+    tmns::outcome::Error deferred { tmns::outcome::cDeferred, TestErrorCode::SECOND, "value ", 42, " of ", 3.5 };
+
+    EXPECT_EQ( deferred.code(), TestErrorCode::SECOND );
+    EXPECT_EQ( deferred.details(), eager.details() );
+    EXPECT_EQ( deferred.message(), eager.message() );
+
+    std::ostringstream sout;
+    sout << deferred;
+    EXPECT_EQ( sout.str(), "second: value 42 of 3.5" );
+}
+
+/**
+ * @test Deferred errors without arguments have empty details.
+ */
+TEST( Error, Deferred_Without_Details )
+{
+    tmns::outcome::Error e { tmns::outcome::cDeferred, TestErrorCode::FIRST };
+    EXPECT_TRUE( e.details().empty() );
+    EXPECT_EQ( e.message(), "first" );
+}
+
+/**
+ * @test Copies of a deferred error share the rendered details.
+ */
+TEST( Error, Deferred_Copy_Shares_Details )
+{
+    std::string name = "tile_0001.tif";
+    tmns::outcome::Error a { tmns::outcome::cDeferred, TestErrorCode::FIRST, "unable to open ", name };
+    name.clear();
+
+    auto b = a;
+    EXPECT_EQ( a.details(), "unable to open tile_0001.tif" );
+    EXPECT_EQ( a.details().data(), b.details().data() );
+}
+
+/**
+ * @test Views of temporary strings are copied when a deferred error is built.
+ */
+TEST( Error, Deferred_Copies_String_Views )
+{
+    auto make = []( const std::string& path ) {
+        return tmns::outcome::Error{ tmns::outcome::cDeferred,
+                                     TestErrorCode::FIRST,
+                                     std::string_view{ path },
+                                     " at ",
+                                     path.c_str() };
+    };
+    auto e = make( std::string( 64, 'x' ) );
+    EXPECT_EQ( e.details(), std::string( 64, 'x' ) + " at " + std::string( 64, 'x' ) );
+}
+
+/**
+ * @test Appending to a deferred error formats the original details first.
+ */
+TEST( Error, Deferred_Append )
+{
+    tmns::outcome::Error e { tmns::outcome::cDeferred, TestErrorCode::FIRST, "tile ", 7 };
+    e.append( "while reading" );
+    EXPECT_EQ( e.details(), "tile 7: while reading" );
+    EXPECT_EQ( e.message(), "first: tile 7: while reading" );
+}
+
+/**
+ * @test Errors are a single pointer wide unless opt-in diagnostics are enabled.
+ */
+TEST( Error, Layout_Is_Pointer_Sized )
+{
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION ) || defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES ) || defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+    // Opt-in diagnostics make the error larger
+    EXPECT_GT( sizeof( tmns::outcome::Error<TestErrorCode> ), sizeof( void* ) );
+#else
+    static_assert( sizeof( tmns::outcome::Error<TestErrorCode> ) == sizeof( void* ) );
+    EXPECT_EQ( sizeof( tmns::outcome::Error<TestErrorCode> ), sizeof( void* ) );
+#endif
+}
+
+/**
+ * @test Errors with only a code can be constants.  A stack trace makes `Error` non-literal, but
+ *       it can still be constant-initialized.
+ */
+TEST( Error, Code_Only_Is_Constexpr )
+{
+#if !defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+    static constexpr tmns::outcome::Error<TestErrorCode> cError{ TestErrorCode::SECOND };
+    static_assert( cError.code_enum() == TestErrorCode::SECOND );
+    static_assert( tmns::outcome::Error<TestErrorCode>{ cError }.code_enum() == TestErrorCode::SECOND );
+#else
+    static constinit const tmns::outcome::Error<TestErrorCode> cError{ TestErrorCode::SECOND };
+#endif
+    EXPECT_EQ( cError.code(), TestErrorCode::SECOND );
+    EXPECT_EQ( cError.details(), "" );
+    EXPECT_EQ( cError.message(), "second" );
+}
+
+/**
+ * @test Copies share the payload and moved-from errors keep their code.
+ */
+TEST( Error, Copy_And_Move_Share_Payload )
+{
+    tmns::outcome::Error a { TestErrorCode::SECOND, "tile ", 3 };
+    auto b = a;
+    EXPECT_EQ( a.details().data(), b.details().data() );
+
+    auto c = std::move( a );
+    EXPECT_EQ( c.details(), "tile 3" );
+    EXPECT_EQ( a.code(), TestErrorCode::SECOND );
+    EXPECT_TRUE( a.details().empty() );
+
+    a = c;
+    EXPECT_EQ( a.message(), "second: tile 3" );
+
+    b.append( "context" );
+    EXPECT_EQ( b.details(), "tile 3: context" );
+    EXPECT_EQ( c.details(), "tile 3" );
+}
+
+/**
+ * @test Context frames flatten in the order they were appended.
+ */
+TEST( Error, Context_Chain_Flattens_Oldest_First )
+{
+    tmns::outcome::Error a { TestErrorCode::FIRST, "tile ", 3 };
+    a.append( "reading band" ).append( "loading image" );
+    EXPECT_EQ( a.details(), "tile 3: reading band: loading image" );
+    EXPECT_EQ( a.message(), "first: tile 3: reading band: loading image" );
+
+    // Appending to an error without details keeps the old separator behavior
+    tmns::outcome::Error b { TestErrorCode::SECOND };
+    b.append( "context" );
+    EXPECT_EQ( b.details(), ": context" );
+    EXPECT_EQ( b.code(), TestErrorCode::SECOND );
+}
+
+/**
+ * @test Frames can be walked individually, newest first.
+ */
+TEST( Error, Context_Chain_Walk )
+{
+    tmns::outcome::Error e { TestErrorCode::FIRST, "root" };
+    e.append( "middle" );
+    e.append( "top" );
+
+    std::vector<std::string> frames;
+    for( const auto frame : e.context() )
+    {
+        frames.emplace_back( frame );
+    }
+    EXPECT_EQ( frames, ( std::vector<std::string>{ "top", "middle", "root" } ) );
+    EXPECT_EQ( e.context().size(), 3 );
+
+    tmns::outcome::Error empty { TestErrorCode::FIRST };
+    EXPECT_TRUE( empty.context().empty() );
+}
+
+/**
+ * @test Copies taken before an append share the older frames but do not see the new one.
+ */
+TEST( Error, Context_Chain_Branches )
+{
+    tmns::outcome::Error a { TestErrorCode::FIRST, "root" };
+    auto b = a;
+    a.append( "left" );
+    b.append( "right" );
+    EXPECT_EQ( a.details(), "root: left" );
+    EXPECT_EQ( b.details(), "root: right" );
+    EXPECT_EQ( a.details().data(), a.details().data() );
+
+    auto c = a;
+    a = b;
+    EXPECT_EQ( c.details(), "root: left" );
+    EXPECT_EQ( a.details(), "root: right" );
+}
+
+/**
+ * @test Deep chains flatten correctly.
+ */
+TEST( Error, Context_Chain_Deep )
+{
+    tmns::outcome::Error e { TestErrorCode::FIRST, "0" };
+    std::string expected = "0";
+    for( int i = 1; i <= 256; ++i )
+    {
+        e.append( std::to_string( i ) );
+        expected += ": " + std::to_string( i );
+    }
+    EXPECT_EQ( e.details(), expected );
+    EXPECT_EQ( e.context().size(), 257 );
+}
+
+/**
+ * @test Releasing a very long chain does not recurse once per frame.
+ */
+TEST( Error, Context_Chain_Release_Is_Iterative )
+{
+    tmns::outcome::Error e { TestErrorCode::FIRST, "root" };
+    for( int i = 0; i < 500000; ++i )
+    {
+        e.append( "frame" );
+    }
+    auto copy = e;
+    e = tmns::outcome::Error{ TestErrorCode::FIRST };
+    EXPECT_EQ( copy.context().size(), 500001 );
+    copy = tmns::outcome::Error{ TestErrorCode::FIRST };
+    EXPECT_TRUE( copy.details().empty() );
+}
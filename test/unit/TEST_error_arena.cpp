@@ -0,0 +1,187 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_arena.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+/**
+ * Memory resource that counts the allocations it forwards upstream.
+ */
+class Counting_Resource : public std::pmr::memory_resource
+{
+    public:
+
+        std::size_t allocations = 0;
+        std::size_t deallocations = 0;
+
+    private:
+
+        void* do_allocate( std::size_t bytes, std::size_t alignment ) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+        }
+
+        void do_deallocate( void* p, std::size_t bytes, std::size_t alignment ) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate( p, bytes, alignment );
+        }
+
+        bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override
+        {
+            return this == &other;
+        }
+
+}; // End of Counting_Resource Class
+
+} // End of anonymous namespace
+
+/********************************************/
+/*          Test the Error Arena            */
+/********************************************/
+/**
+ * @test The default error resource is the standard default resource.
+ */
+TEST( Error_Arena, Default_Resource )
+{
+    EXPECT_EQ( tmns::outcome::error_memory_resource(), std::pmr::get_default_resource() );
+}
+
+/**
+ * @test Scoped arenas install and restore the error resource, and nest.
+ */
+TEST( Error_Arena, Scope_Installs_And_Restores )
+{
+    Counting_Resource outer;
+    Counting_Resource inner;
+    {
+        tmns::outcome::Scoped_Error_Arena a{ &outer };
+        EXPECT_EQ( tmns::outcome::error_memory_resource(), &outer );
+        {
+            tmns::outcome::Scoped_Error_Arena b{ &inner };
+            EXPECT_EQ( tmns::outcome::error_memory_resource(), &inner );
+        }
+        EXPECT_EQ( tmns::outcome::error_memory_resource(), &outer );
+    }
+    EXPECT_EQ( tmns::outcome::error_memory_resource(), std::pmr::get_default_resource() );
+}
+
+/**
+ * @test Error payloads are allocated from the installed resource and returned to it.
+ */
+TEST( Error_Arena, Payload_Uses_Scoped_Resource )
+{
+    Counting_Resource resource;
+    {
+        tmns::outcome::Scoped_Error_Arena scope{ &resource };
+
+        tmns::outcome::Error code_only { TestErrorCode::FIRST };
+        EXPECT_EQ( resource.allocations, 0u );
+
+        tmns::outcome::Error e { TestErrorCode::FIRST, "tile ", 42, " could not be decoded as a full tile" };
+        EXPECT_GT( resource.allocations, 0u );
+        EXPECT_EQ( e.details(), "tile 42 could not be decoded as a full tile" );
+
+        tmns::outcome::Error d { tmns::outcome::cDeferred, TestErrorCode::SECOND, "tile ", 43 };
+        EXPECT_EQ( d.message(), "second: tile 43" );
+    }
+    EXPECT_EQ( resource.allocations, resource.deallocations );
+}
+
+/**
+ * @test Errors can be allocated from an explicit allocator.
+ */
+TEST( Error_Arena, Explicit_Allocator )
+{
+    Counting_Resource resource;
+    {
+        tmns::outcome::Error e { std::allocator_arg, &resource, TestErrorCode::SECOND, "band ", 3 };
+        EXPECT_EQ( e.message(), "second: band 3" );
+        EXPECT_GT( resource.allocations, 0u );
+
+        tmns::outcome::Result<int,TestErrorCode> r = tmns::outcome::fail( std::allocator_arg, &resource, TestErrorCode::FIRST, "x" );
+        EXPECT_EQ( r.assume_error().details(), "x" );
+
+        tmns::outcome::Result<int,TestErrorCode> d = tmns::outcome::fail( std::allocator_arg, &resource, tmns::outcome::cDeferred, TestErrorCode::FIRST, "y" );
+        EXPECT_EQ( d.assume_error().details(), "y" );
+    }
+    EXPECT_EQ( resource.allocations, resource.deallocations );
+}
+
+/**
+ * @test Reading and appending to an error on another thread never allocates from the resource
+ *       of the thread that created it.
+ */
+TEST( Error_Arena, Other_Thread_Leaves_Owner_Resource_Alone )
+{
+    Counting_Resource owner;
+    Counting_Resource worker;
+    {
+        tmns::outcome::Error deferred { std::allocator_arg, &owner, tmns::outcome::cDeferred, TestErrorCode::SECOND, "tile ", 43 };
+        tmns::outcome::Error framed { std::allocator_arg, &owner, TestErrorCode::FIRST, "tile 44" };
+        framed.append( "reading band 2" );
+        const auto owner_allocations = owner.allocations;
+
+        std::thread reader( [&] {
+            tmns::outcome::Scoped_Error_Arena scope{ &worker };
+            EXPECT_EQ( deferred.details(), "tile 43" );
+            EXPECT_EQ( framed.details(), "tile 44: reading band 2" );
+
+            tmns::outcome::Error moved = std::move( framed );
+            moved.append( "decoding" );
+            EXPECT_EQ( moved.details(), "tile 44: reading band 2: decoding" );
+        } );
+        reader.join();
+
+        EXPECT_EQ( owner.allocations, owner_allocations );
+        EXPECT_GT( worker.allocations, 0u );
+    }
+    EXPECT_EQ( owner.allocations, owner.deallocations );
+    EXPECT_EQ( worker.allocations, worker.deallocations );
+}
+
+/**
+ * @test The thread-local arena serves errors until it is reset.
+ */
+TEST( Error_Arena, Thread_Local_Arena_Reset )
+{
+    auto& arena = tmns::outcome::Error_Arena::thread_local_instance();
+    for( int tile = 0; tile < 4; ++tile )
+    {
+        {
+            tmns::outcome::Scoped_Error_Arena scope{ arena };
+            tmns::outcome::Error e { TestErrorCode::FIRST, "tile ", tile };
+            e.append( "while warping" );
+            EXPECT_EQ( e.details(), "tile " + std::to_string( tile ) + ": while warping" );
+        }
+        arena.reset();
+    }
+}
@@ -0,0 +1,110 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_category.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+/************************************************/
+/*          Test the Error_Category Class       */
+/************************************************/
+/**
+ * @test Table-backed categories resolve messages at compile time.
+ */
+TEST( Error_Category, Message_View_Is_Constexpr )
+{
+    static_assert( Table_Error_Category::message_view( 1 ) == "first" );
+    static_assert( Table_Error_Category::message_view( 7 ) == "unknown" );
+    static_assert( Table_Error_Category::message_view( -1 ) == "unknown" );
+    EXPECT_EQ( Table_Error_Category::message_view( 2 ), "second" );
+}
+
+/**
+ * @test Category singletons are constant-initialized, so their address is a constant.
+ */
+TEST( Error_Category, Singleton_Is_Constant )
+{
+    static constexpr const std::error_category* cCategory = &Table_Error_Category::get();
+    static_assert( cCategory == &outcome_error_category( TableErrorCode::FIRST ) );
+    EXPECT_EQ( std::error_code{ TableErrorCode::FIRST }.category(), *cCategory );
+}
+
+/**
+ * @test The std::error_category interface still reports the table messages.
+ */
+TEST( Error_Category, Standard_Message_Uses_Table )
+{
+    std::error_code ec = TableErrorCode::SECOND;
+    EXPECT_EQ( ec.message(), "second" );
+    EXPECT_STREQ( ec.category().name(), "TableError" );
+    EXPECT_EQ( std::error_code{ static_cast<TableErrorCode>( 9 ) }.message(), "unknown" );
+}
+
+/**
+ * @test Errors with table-backed categories expose the code message without details.
+ */
+TEST( Error_Category, Error_Uses_Message_View )
+{
+    tmns::outcome::Error e { TableErrorCode::FIRST, "band ", 2 };
+    EXPECT_EQ( e.code_message(), "first" );
+    EXPECT_EQ( e.message(), "first: band 2" );
+
+    std::ostringstream sout;
+    sout << e;
+    EXPECT_EQ( sout.str(), "first: band 2" );
+}
+
+/**
+ * @test Categories that override message_() keep working.
+ */
+TEST( Error_Category, Virtual_Message_Fallback )
+{
+    static_assert( !tmns::outcome::impl::Has_Message_View<TestErrorCode> );
+    static_assert( tmns::outcome::impl::Has_Message_View<TableErrorCode> );
+
+    tmns::outcome::Error e { TestErrorCode::SECOND, "x" };
+    std::ostringstream sout;
+    sout << e;
+    EXPECT_EQ( sout.str(), "second: x" );
+}
+
+/**
+ * @test The Terminus error codes map to their names.
+ */
+TEST( Error_Category, Core_Error_Codes )
+{
+    using tmns::core::error::Error_Code;
+    using tmns::core::error::Error_Category;
+
+    static_assert( Error_Category::message_view( static_cast<int>( Error_Code::UNINITIALIZED ) ) == "UNINITIALIZED" );
+    EXPECT_EQ( Error_Category::message_view( static_cast<int>( Error_Code::DRIVER_NOT_FOUND ) ), "DRIVER_NOT_FOUND" );
+    EXPECT_EQ( Error_Category::message_view( static_cast<int>( Error_Code::DRIVER_FAILURE ) ), "DRIVER_FAILURE" );
+    EXPECT_EQ( Error_Category::message_view( 1000 ), "UNKNOWN" );
+
+    tmns::outcome::Error e { Error_Code::FILE_NOT_FOUND, "scene.tif" };
+    EXPECT_EQ( e.message(), "FILE_NOT_FOUND: scene.tif" );
+    EXPECT_STREQ( e.code().category().name(), "Error" );
+}
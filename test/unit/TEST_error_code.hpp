@@ -15,7 +15,9 @@
 #pragma once
 
 // C++ Libraries
+#include <array>
 #include <optional>
+#include <string_view>
 
 // Terminus Libraries
 #include <terminus/outcome.hpp>
@@ -54,3 +56,27 @@ class outcome_Error_Category : public tmns::outcome::Error_Category<outcome_Erro
 }; // End of TestErrorCategory Class
 
 TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY( outcome_Error_Category, TestErrorCode );
+
+enum class TableErrorCode { SUCCESS = 0, FIRST = 1, SECOND = 2 };
+
+TERMINUS_OUTCOME_MARK_ENUM( TableErrorCode )
+
+/**
+ * @brief Error Category for TableErrorCode, using a constexpr message table
+ */
+class Table_Error_Category : public tmns::outcome::Error_Category<Table_Error_Category>
+{
+    public:
+
+        static constexpr std::array<std::string_view,3> cMessages { "success", "first", "second" };
+
+    protected:
+
+        const char* name_() const noexcept override
+        {
+            return "TableError";
+        }
+
+}; // End of Table_Error_Category Class
+
+TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY( Table_Error_Category, TableErrorCode )
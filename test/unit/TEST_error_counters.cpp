@@ -0,0 +1,151 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_counters.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/error_counters.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+/**
+ * @brief Current count for one category and code, or zero.
+ */
+std::uint64_t count_of( std::string_view category, int code )
+{
+    for( const auto& c : tmns::outcome::error_counts() )
+    {
+        if( c.category == category && c.code == code )
+        {
+            return c.count;
+        }
+    }
+    return 0;
+}
+
+} // End of anonymous namespace
+
+/****************************************************/
+/*          Test the Prometheus Writer              */
+/****************************************************/
+/**
+ * @test Counters are written as one counter family, with label values escaped.
+ */
+TEST( Error_Counters, WritePrometheus )
+{
+    std::vector<tmns::outcome::Error_Count> counts{ { "io", 7, "NOT_FOUND", 12 },
+                                                    { "test", 1, "a \"quoted\"\nname", 3 } };
+    std::ostringstream out;
+    tmns::outcome::write_prometheus( out, counts );
+    EXPECT_EQ( out.str(),
+               "# HELP terminus_outcome_errors_total Errors created, by category and code.\n"
+               "# TYPE terminus_outcome_errors_total counter\n"
+               "terminus_outcome_errors_total{category=\"io\",code=\"NOT_FOUND\",value=\"7\"} 12\n"
+               "terminus_outcome_errors_total{category=\"test\",code=\"a \\\"quoted\\\"\\nname\",value=\"1\"} 3\n" );
+
+    const auto path = std::filesystem::temp_directory_path() / "terminus_outcome_errors.prom";
+    ASSERT_FALSE( tmns::outcome::write_prometheus( path, counts ) );
+    std::ifstream in{ path };
+    EXPECT_EQ( std::string( std::istreambuf_iterator<char>{ in }, {} ), out.str() );
+    EXPECT_FALSE( std::filesystem::exists( path.string() + ".tmp" ) );
+    std::filesystem::remove( path );
+
+    EXPECT_TRUE( tmns::outcome::write_prometheus( "/nonexistent/dir/errors.prom", counts ) );
+}
+
+/****************************************************/
+/*            Test the Error Counters               */
+/****************************************************/
+/**
+ * @test Explicit counts and domain codes are reported by name.
+ */
+TEST( Error_Counters, CountError )
+{
+    using tmns::core::error::Error_Code;
+    const auto before = count_of( "Error", static_cast<int>( Error_Code::NOT_FOUND ) );
+    tmns::outcome::count_error( Error_Code::NOT_FOUND );
+    tmns::outcome::count_error( Error_Code::NOT_FOUND );
+    EXPECT_EQ( count_of( "Error", static_cast<int>( Error_Code::NOT_FOUND ) ), before + 2 );
+
+    for( const auto& c : tmns::outcome::error_counts() )
+    {
+        if( c.category == "Error" && c.code == static_cast<int>( Error_Code::NOT_FOUND ) )
+        {
+            EXPECT_EQ( c.name, "NOT_FOUND" );
+        }
+    }
+
+    // Codes past the table share the overflow counter
+    const auto overflow = count_of( "TestError", -1 );
+    tmns::outcome::count_error( static_cast<TestErrorCode>( 1000 ) );
+    EXPECT_EQ( count_of( "TestError", -1 ), overflow + 1 );
+}
+
+#if defined( TERMINUS_OUTCOME_ENABLE_ERROR_COUNTERS )
+
+/**
+ * @test Every error constructed is counted once, across threads; copies are not counted.
+ */
+TEST( Error_Counters, ErrorsAreCounted )
+{
+    const auto before = count_of( "TestError", 2 );
+    std::vector<std::thread> threads;
+    for( int t = 0; t < 4; ++t )
+    {
+        threads.emplace_back( [] {
+            for( int i = 0; i < 1000; ++i )
+            {
+                tmns::outcome::Error e{ TestErrorCode::SECOND, "tile ", i };
+                auto copy = e;
+            }
+        } );
+    }
+    for( auto& t : threads )
+    {
+        t.join();
+    }
+    tmns::outcome::Error deferred{ tmns::outcome::cDeferred, TestErrorCode::SECOND };
+    EXPECT_EQ( count_of( "TestError", 2 ), before + 4001 );
+}
+
+#else
+
+/**
+ * @test Without the option, constructing errors counts nothing.
+ */
+TEST( Error_Counters, Disabled )
+{
+    const auto before = count_of( "TestError", 2 );
+    tmns::outcome::Error e{ TestErrorCode::SECOND };
+    EXPECT_EQ( count_of( "TestError", 2 ), before );
+}
+
+#endif
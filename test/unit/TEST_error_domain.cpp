@@ -0,0 +1,99 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_domain.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+
+#define TEST_IO_ERROR_CODES( X )    \
+    X( SUCCESS,   "success" )       \
+    X( BAD_READ,  "bad read" )      \
+    X( BAD_WRITE, "bad write" )     \
+    X( NOT_FOUND, "not found" )
+
+TERMINUS_OUTCOME_DEFINE_ERROR_DOMAIN( test::io, IoErrorCode, IoErrorCategory, "IoError", TEST_IO_ERROR_CODES );
+
+/**********************************************/
+/*          Test the Error Domain Macro       */
+/**********************************************/
+/**
+ * @test The generated enumeration is dense and counted.
+ */
+TEST( Error_Domain, Enumeration_And_Count )
+{
+    static_assert( static_cast<int>( test::io::IoErrorCode::SUCCESS ) == 0 );
+    static_assert( static_cast<int>( test::io::IoErrorCode::NOT_FOUND ) == 3 );
+    static_assert( tmns::outcome::error_code_count<test::io::IoErrorCode>() == 4 );
+    static_assert( std::is_error_code_enum_v<test::io::IoErrorCode> );
+}
+
+/**
+ * @test Codes map to their names and messages.
+ */
+TEST( Error_Domain, Names_And_Messages )
+{
+    using test::io::IoErrorCode;
+    static_assert( tmns::outcome::error_code_name( IoErrorCode::BAD_WRITE ) == "BAD_WRITE" );
+    static_assert( test::io::IoErrorCategory::message_view( 1 ) == "bad read" );
+    EXPECT_TRUE( tmns::outcome::error_code_name( static_cast<IoErrorCode>( 12 ) ).empty() );
+
+    std::error_code ec = IoErrorCode::NOT_FOUND;
+    EXPECT_EQ( ec.message(), "not found" );
+    EXPECT_STREQ( ec.category().name(), "IoError" );
+
+    tmns::outcome::Error e { IoErrorCode::BAD_READ, "tile ", 4 };
+    EXPECT_EQ( e.message(), "bad read: tile 4" );
+}
+
+/**
+ * @test Names parse back into codes, and unknown names are rejected.
+ */
+TEST( Error_Domain, Parse_Names )
+{
+    using test::io::IoErrorCode;
+    static_assert( tmns::outcome::parse_error_code<IoErrorCode>( "BAD_READ" ) == IoErrorCode::BAD_READ );
+    static_assert( !tmns::outcome::parse_error_code<IoErrorCode>( "bad read" ) );
+
+    EXPECT_EQ( tmns::outcome::parse_error_code<IoErrorCode>( "SUCCESS" ), IoErrorCode::SUCCESS );
+    EXPECT_FALSE( tmns::outcome::parse_error_code<IoErrorCode>( "" ).has_value() );
+    EXPECT_FALSE( tmns::outcome::parse_error_code<IoErrorCode>( "NOT_FOUND_" ).has_value() );
+}
+
+/**
+ * @test The Terminus error codes keep their values and round trip through their names.
+ */
+TEST( Error_Domain, Core_Error_Codes_Round_Trip )
+{
+    using tmns::core::error::Error_Code;
+    static_assert( static_cast<int>( Error_Code::FILE_NOT_FOUND ) == 9 );
+    static_assert( static_cast<int>( Error_Code::UNINITIALIZED ) == 26 );
+    static_assert( tmns::outcome::error_code_count<Error_Code>() == 27 );
+
+    for( std::size_t i = 0; i < tmns::outcome::error_code_count<Error_Code>(); ++i )
+    {
+        const auto code = static_cast<Error_Code>( i );
+        const auto name = tmns::outcome::error_code_name( code );
+        EXPECT_EQ( tmns::outcome::parse_error_code<Error_Code>( name ), code ) << name;
+    }
+    EXPECT_FALSE( tmns::outcome::parse_error_code<Error_Code>( "GDAL" ).has_value() );
+}
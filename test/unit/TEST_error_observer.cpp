@@ -0,0 +1,307 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_observer.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/error_observer.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+/**
+ * @brief Report an event for `code` with `details` to `ring`.
+ */
+void record( tmns::outcome::Error_Ring_Buffer& ring, TestErrorCode code, const std::string& details )
+{
+    ring.on_error( tmns::outcome::Error_Event{ make_error_code( code ),
+                                               details,
+                                               std::source_location::current(),
+                                               tmns::outcome::Error_Event::Kind::FAIL } );
+}
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/// Ring the signal handler records into
+tmns::outcome::Error_Ring_Buffer* g_signal_ring = nullptr;
+
+/// Records made by the signal handler
+volatile std::sig_atomic_t g_signal_records = 0;
+
+/**
+ * @brief Signal handler recording an event to `g_signal_ring`.
+ */
+extern "C" void record_from_signal( int )
+{
+    g_signal_ring->on_error( tmns::outcome::Error_Event{ make_error_code( TestErrorCode::SECOND ),
+                                                         "signal",
+                                                         std::source_location::current(),
+                                                         tmns::outcome::Error_Event::Kind::FAIL } );
+    g_signal_records = g_signal_records + 1;
+}
+
+#endif
+
+} // End of anonymous namespace
+
+/****************************************************/
+/*            Test the Error Ring Buffer            */
+/****************************************************/
+/**
+ * @test The ring keeps the newest records, oldest first, with truncated details.
+ */
+TEST( Error_Ring_Buffer, Recent )
+{
+    tmns::outcome::Error_Ring_Buffer ring{ 3 };
+    EXPECT_EQ( ring.capacity(), 4 );
+
+    std::array<tmns::outcome::Error_Record,8> out;
+    EXPECT_EQ( ring.recent( out ), 0 );
+
+    for( int i = 0; i < 6; ++i )
+    {
+        record( ring, TestErrorCode::FIRST, "tile " + std::to_string( i ) );
+    }
+    ASSERT_EQ( ring.recent( out ), 4 );
+    for( int i = 0; i < 4; ++i )
+    {
+        EXPECT_EQ( out[i].details(), "tile " + std::to_string( i + 2 ) );
+        EXPECT_EQ( out[i].error_code(), make_error_code( TestErrorCode::FIRST ) );
+        EXPECT_EQ( out[i].thread, std::this_thread::get_id() );
+        EXPECT_EQ( out[i].kind, tmns::outcome::Error_Event::Kind::FAIL );
+        EXPECT_GT( out[i].line, 0 );
+    }
+
+    // The destination bounds the copy to the newest records
+    ASSERT_EQ( ring.recent( std::span( out ).first( 2 ) ), 2 );
+    EXPECT_EQ( out[0].details(), "tile 4" );
+    EXPECT_EQ( out[1].details(), "tile 5" );
+
+    record( ring, TestErrorCode::SECOND, std::string( 200, 'x' ) );
+    ASSERT_EQ( ring.recent( std::span( out ).first( 1 ) ), 1 );
+    EXPECT_EQ( out[0].details(), std::string( tmns::outcome::Error_Record::cDetails_Size, 'x' ) );
+}
+
+/**
+ * @test Draining hands over each record once, and counts the ones overwritten first.
+ */
+TEST( Error_Ring_Buffer, Drain )
+{
+    tmns::outcome::Error_Ring_Buffer ring{ 4 };
+    std::vector<std::string> drained;
+    auto collect = [&]( const tmns::outcome::Error_Record& r ) { drained.emplace_back( r.details() ); };
+
+    EXPECT_EQ( ring.drain( collect ), 0 );
+    record( ring, TestErrorCode::FIRST, "a" );
+    record( ring, TestErrorCode::FIRST, "b" );
+    EXPECT_EQ( ring.drain( collect ), 2 );
+    EXPECT_EQ( ring.drain( collect ), 0 );
+
+    for( char c = 'c'; c <= 'h'; ++c )
+    {
+        record( ring, TestErrorCode::FIRST, std::string( 1, c ) );
+    }
+    EXPECT_EQ( ring.drain( collect ), 4 );
+    EXPECT_EQ( drained, ( std::vector<std::string>{ "a", "b", "e", "f", "g", "h" } ) );
+    EXPECT_EQ( ring.lost(), 2 );
+}
+
+/**
+ * @test Concurrent writers lose nothing unaccounted, and each thread's records drain in order.
+ */
+TEST( Error_Ring_Buffer, ConcurrentWriters )
+{
+    constexpr int cThreads = 4;
+    constexpr int cErrors  = 2000;
+    tmns::outcome::Error_Ring_Buffer ring{ 256 };
+
+    std::atomic<bool> done{ false };
+    std::size_t drained = 0;
+    std::array<int,cThreads> last;
+    last.fill( -1 );
+    bool ordered = true;
+    auto consume = [&]( const tmns::outcome::Error_Record& r ) {
+        const auto t = std::stoi( std::string( r.details().substr( 0, 1 ) ) );
+        const auto i = std::stoi( std::string( r.details().substr( 2 ) ) );
+        ordered = ordered && i > last[t];
+        last[t] = i;
+        ++drained;
+    };
+
+    std::thread consumer{ [&] {
+        while( !done.load() )
+        {
+            ring.drain( consume );
+        }
+    } };
+    std::vector<std::thread> writers;
+    for( int t = 0; t < cThreads; ++t )
+    {
+        writers.emplace_back( [&ring, t] {
+            for( int i = 0; i < cErrors; ++i )
+            {
+                record( ring, TestErrorCode::SECOND, std::to_string( t ) + " " + std::to_string( i ) );
+            }
+        } );
+    }
+    for( auto& w : writers )
+    {
+        w.join();
+    }
+    done = true;
+    consumer.join();
+    ring.drain( consume );
+
+    EXPECT_TRUE( ordered );
+    EXPECT_EQ( drained + ring.lost(), std::size_t{ cThreads * cErrors } );
+}
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+/**
+ * @test A signal handler recording while the interrupted thread is still writing the same slot
+ *       drops its record, and draining counts it as lost rather than waiting for it.
+ */
+TEST( Error_Ring_Buffer, SignalHandlerDropsAreCounted )
+{
+    constexpr int cIterations = 200000;
+    tmns::outcome::Error_Ring_Buffer ring{ 1 };
+    g_signal_ring = &ring;
+    g_signal_records = 0;
+
+    struct sigaction action{};
+    action.sa_handler = record_from_signal;
+    ASSERT_EQ( sigaction( SIGALRM, &action, nullptr ), 0 );
+    sigset_t alarm;
+    sigemptyset( &alarm );
+    sigaddset( &alarm, SIGALRM );
+
+    itimerval timer{ { 0, 50 }, { 0, 50 } };
+    ASSERT_EQ( setitimer( ITIMER_REAL, &timer, nullptr ), 0 );
+
+    std::size_t drained = 0;
+    auto consume = [&]( const tmns::outcome::Error_Record& ) { ++drained; };
+    bool accounted = true;
+    for( int i = 1; i <= cIterations && accounted; ++i )
+    {
+        record( ring, TestErrorCode::FIRST, "tile" );
+
+        pthread_sigmask( SIG_BLOCK, &alarm, nullptr );
+        ring.drain( consume );
+        accounted = drained + ring.lost() == std::size_t( i ) + g_signal_records;
+        pthread_sigmask( SIG_UNBLOCK, &alarm, nullptr );
+    }
+
+    timer = {};
+    setitimer( ITIMER_REAL, &timer, nullptr );
+    signal( SIGALRM, SIG_DFL );
+    EXPECT_TRUE( accounted );
+    EXPECT_GT( g_signal_records, 0 );
+}
+
+#endif
+
+/****************************************************/
+/*            Test the Observer Hook                */
+/****************************************************/
+#if defined( TERMINUS_OUTCOME_ENABLE_ERROR_OBSERVER )
+
+/**
+ * @test `fail()` and `panic()` report new errors; errors passed along are not reported again.
+ */
+TEST( Error_Observer, FailAndPanicAreObserved )
+{
+    tmns::outcome::Error_Ring_Buffer ring{ 8 };
+    EXPECT_EQ( tmns::outcome::set_error_observer( &ring ), nullptr );
+
+    const auto line = std::source_location::current().line() + 1;
+    tmns::outcome::Result<int,TestErrorCode> result = tmns::outcome::fail( TestErrorCode::FIRST, "tile ", 7 );
+    tmns::outcome::Result<int,TestErrorCode> passed = tmns::outcome::fail( result.error() );
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+    // The panic handler aborts, so the panic is only observed in the child process
+    const auto panic_line = std::source_location::current().line() + 1;
+    EXPECT_DEATH( tmns::outcome::panic( TestErrorCode::SECOND, "corrupt" ), "corrupt" );
+    const std::size_t observed = 1;
+#else
+    const auto panic_line = std::source_location::current().line() + 1;
+    EXPECT_THROW( tmns::outcome::panic( TestErrorCode::SECOND, "corrupt" ), std::system_error );
+    const std::size_t observed = 2;
+#endif
+
+    // Reporting does not format deferred details
+    tmns::outcome::Result<int,TestErrorCode> deferred = tmns::outcome::fail( tmns::outcome::cDeferred, TestErrorCode::FIRST, "tile ", 8 );
+
+    EXPECT_EQ( tmns::outcome::set_error_observer( nullptr ), &ring );
+    tmns::outcome::Result<int,TestErrorCode> unobserved = tmns::outcome::fail( TestErrorCode::FIRST );
+    EXPECT_TRUE( passed.has_error() && unobserved.has_error() );
+
+    std::array<tmns::outcome::Error_Record,8> out;
+    ASSERT_EQ( ring.recent( out ), observed + 1 );
+    EXPECT_EQ( out[0].error_code(), make_error_code( TestErrorCode::FIRST ) );
+    EXPECT_EQ( out[0].details(), "tile 7" );
+    EXPECT_FALSE( out[0].details_deferred );
+    EXPECT_EQ( out[0].kind, tmns::outcome::Error_Event::Kind::FAIL );
+    EXPECT_EQ( out[0].line, line );
+    EXPECT_TRUE( out[observed].details().empty() );
+    EXPECT_TRUE( out[observed].details_deferred );
+    EXPECT_EQ( deferred.assume_error().details(), "tile 8" );
+    if( observed == 2 )
+    {
+        EXPECT_EQ( out[1].error_code(), make_error_code( TestErrorCode::SECOND ) );
+        EXPECT_EQ( out[1].details(), "corrupt" );
+        EXPECT_EQ( out[1].kind, tmns::outcome::Error_Event::Kind::PANIC );
+        EXPECT_EQ( out[1].line, panic_line );
+        EXPECT_TRUE( std::string_view{ out[1].file }.ends_with( "TEST_error_observer.cpp" ) );
+    }
+}
+
+#else
+
+/**
+ * @test Without the option, the installed observer sees nothing.
+ */
+TEST( Error_Observer, Disabled )
+{
+    tmns::outcome::Error_Ring_Buffer ring{ 8 };
+    tmns::outcome::set_error_observer( &ring );
+    tmns::outcome::Result<int,TestErrorCode> result = tmns::outcome::fail( TestErrorCode::FIRST );
+    tmns::outcome::set_error_observer( nullptr );
+    EXPECT_TRUE( result.has_error() );
+
+    std::array<tmns::outcome::Error_Record,8> out;
+    EXPECT_EQ( ring.recent( out ), 0 );
+}
+
+#endif
@@ -0,0 +1,140 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_error_stacktrace.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ */
+
+// C++ Standard Libraries
+#include <sstream>
+#include <string>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+namespace {
+
+using Policy = tmns::outcome::Stacktrace_Policy<TestErrorCode>;
+
+/**
+ * Restores the default policy when a test ends.
+ */
+class Error_Stacktrace : public ::testing::Test
+{
+    protected:
+
+        void TearDown() override
+        {
+            Policy::capture_all();
+            Policy::sample_one_in( 0 );
+        }
+};
+
+} // End of anonymous namespace
+
+#if defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+
+/**
+ * @test Nothing is captured until the policy is configured.
+ */
+TEST_F( Error_Stacktrace, Off_By_Default )
+{
+    EXPECT_FALSE( Policy::should_capture( 1 ) );
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::FIRST, "tile ", 2 ).stacktrace(), nullptr );
+}
+
+/**
+ * @test Selected errors capture a trace, and copies share it.
+ */
+TEST_F( Error_Stacktrace, Captured_When_Selected )
+{
+    Policy::capture_all();
+
+    tmns::outcome::Error e { TestErrorCode::FIRST, "tile ", 2 };
+    ASSERT_NE( e.stacktrace(), nullptr );
+    EXPECT_GT( e.stacktrace()->size(), 0u );
+
+    auto copy = e;
+    EXPECT_EQ( copy.stacktrace(), e.stacktrace() );
+
+    std::ostringstream sout;
+    sout << *e.stacktrace();
+    EXPECT_FALSE( sout.str().empty() );
+}
+
+/**
+ * @test Only the selected codes capture a trace.
+ */
+TEST_F( Error_Stacktrace, Code_Filter )
+{
+    Policy::capture_codes( { TestErrorCode::SECOND } );
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::FIRST, "x" ).stacktrace(), nullptr );
+    EXPECT_NE( tmns::outcome::Error( TestErrorCode::SECOND, "x" ).stacktrace(), nullptr );
+    EXPECT_NE( tmns::outcome::Error( tmns::outcome::cDeferred, TestErrorCode::SECOND, 1 ).stacktrace(), nullptr );
+
+    Policy::capture_none();
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::SECOND, "x" ).stacktrace(), nullptr );
+}
+
+/**
+ * @test Errors with only a code capture a trace when their code is selected, including those
+ *       created by `fail()`.
+ */
+TEST_F( Error_Stacktrace, Code_Only )
+{
+    Policy::capture_codes( { TestErrorCode::SECOND } );
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::FIRST ).stacktrace(), nullptr );
+    EXPECT_NE( tmns::outcome::Error( TestErrorCode::SECOND ).stacktrace(), nullptr );
+
+    tmns::outcome::Result<int,TestErrorCode> r = tmns::outcome::fail( TestErrorCode::SECOND );
+    ASSERT_TRUE( r.has_failure() );
+    ASSERT_NE( r.assume_error().stacktrace(), nullptr );
+    EXPECT_GT( r.assume_error().stacktrace()->size(), 0u );
+}
+
+/**
+ * @test Sampling on its own captures one in every `n` errors of any code on a thread.
+ */
+TEST_F( Error_Stacktrace, Sampling )
+{
+    Policy::sample_one_in( 4 );
+    int captured = 0;
+    for( int i = 0; i < 40; ++i )
+    {
+        captured += tmns::outcome::Error( TestErrorCode::FIRST, "x" ).stacktrace() != nullptr;
+    }
+    EXPECT_EQ( captured, 10 );
+
+    Policy::sample_one_in( 0 );
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::FIRST, "x" ).stacktrace(), nullptr );
+}
+
+#else
+
+/**
+ * @test Without `TERMINUS_OUTCOME_ENABLE_STACKTRACE` nothing is captured, and configuring the
+ *       policy still compiles.
+ */
+TEST_F( Error_Stacktrace, Disabled )
+{
+    Policy::capture_codes( { TestErrorCode::FIRST } );
+    Policy::sample_one_in( 1 );
+    EXPECT_FALSE( Policy::should_capture( 1 ) );
+    EXPECT_EQ( tmns::outcome::Error( TestErrorCode::FIRST, "x" ).stacktrace(), nullptr );
+}
+
+#endif
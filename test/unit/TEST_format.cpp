@@ -0,0 +1,118 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_format.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <sstream>
+#include <string>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/format.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+/****************************************************/
+/*              Test the Stream Output              */
+/****************************************************/
+/**
+ * @test Results write their value, "ok", or the error to a stream.
+ */
+TEST( Format, Stream )
+{
+    std::ostringstream sout;
+    sout << tmns::outcome::Result<int,TestErrorCode>{ 5 } << ' '
+         << tmns::outcome::Result<void,TestErrorCode>{ tmns::outcome::ok() } << ' '
+         << tmns::outcome::Result<int,TestErrorCode>{ tmns::outcome::fail( TestErrorCode::FIRST, "tile ", 7 ) };
+    EXPECT_EQ( sout.str(), "5 ok error: first: tile 7" );
+}
+
+#if defined( TERMINUS_OUTCOME_HAS_FORMAT )
+
+/****************************************************/
+/*              Test the Error Formatter            */
+/****************************************************/
+/**
+ * @test The spec selects the full message, the category and code, or the enumerator name.
+ */
+TEST( Format, Error )
+{
+    using tmns::core::error::Error_Code;
+    const tmns::outcome::Error error{ Error_Code::NOT_FOUND, "tile 7" };
+
+    EXPECT_EQ( std::format( "{}", error ), "NOT_FOUND: tile 7" );
+    EXPECT_EQ( std::format( "{:f}", error ), "NOT_FOUND: tile 7" );
+    EXPECT_EQ( std::format( "{:c}", error ), "Error 18" );
+    EXPECT_EQ( std::format( "{:n}", error ), "NOT_FOUND" );
+
+    // Categories without tables fall back to the category's message
+    const tmns::outcome::Error other{ TestErrorCode::SECOND };
+    EXPECT_EQ( std::format( "{}", other ), "second" );
+    EXPECT_EQ( std::format( "{:n}", other ), "second" );
+    EXPECT_EQ( std::format( "{:c}", other ), "TestError 2" );
+
+    std::ostringstream sout;
+    sout << error;
+    EXPECT_EQ( sout.str(), std::format( "{}", error ) );
+}
+
+/****************************************************/
+/*        Test the Result and Optional Formatters   */
+/****************************************************/
+/**
+ * @test Results format their value or their error, and optionals pass the spec to the value.
+ */
+TEST( Format, Result_And_Optional )
+{
+    using Int_Result = tmns::outcome::Result<int,TestErrorCode>;
+    EXPECT_EQ( std::format( "{}", Int_Result{ 5 } ), "5" );
+    EXPECT_EQ( std::format( "{}", tmns::outcome::Result<void,TestErrorCode>{ tmns::outcome::ok() } ), "ok" );
+
+    const Int_Result failed = tmns::outcome::fail( TestErrorCode::FIRST, "tile 7" );
+    EXPECT_EQ( std::format( "{}", failed ), "error: first: tile 7" );
+    EXPECT_EQ( std::format( "{:c}", failed ), "error: TestError 1" );
+
+    EXPECT_EQ( std::format( "{:.2f}", tmns::outcome::Optional<double>{ 1.5 } ), "1.50" );
+    EXPECT_EQ( std::format( "{:>4}", tmns::outcome::Optional<std::string>{ std::string{ "ab" } } ), "  ab" );
+    EXPECT_EQ( std::format( "{}", tmns::outcome::Optional<int>{} ), "empty" );
+}
+
+/****************************************************/
+/*          Test the Formatted Failure Form         */
+/****************************************************/
+/**
+ * @test `fail( cFormat, ... )` formats the details, truncating ones longer than the buffer.
+ */
+TEST( Format, Fail )
+{
+    const int tile = 7;
+    tmns::outcome::Result<int,TestErrorCode> result =
+        tmns::outcome::fail( tmns::outcome::cFormat, TestErrorCode::SECOND, "tile {} of {:03}", tile, 9 );
+    ASSERT_TRUE( result.has_error() );
+    EXPECT_EQ( result.error().code(), make_error_code( TestErrorCode::SECOND ) );
+    EXPECT_EQ( result.error().details(), "tile 7 of 009" );
+
+    const std::string wide( TERMINUS_OUTCOME_FORMAT_CAPACITY + 10, 'x' );
+    result = tmns::outcome::fail( tmns::outcome::cFormat, TestErrorCode::FIRST, "{}", wide );
+    const auto details = result.error().details();
+    EXPECT_EQ( details.size(), TERMINUS_OUTCOME_FORMAT_CAPACITY );
+    EXPECT_EQ( details.substr( details.size() - 3 ), "..." );
+}
+
+#endif
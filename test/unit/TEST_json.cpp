@@ -0,0 +1,106 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_json.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <limits>
+#include <source_location>
+#include <string>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/json.hpp>
+#include <terminus/outcome/wire.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+/****************************************************/
+/*            Test the JSON Error Writer            */
+/****************************************************/
+/**
+ * @test Errors are written with their category, code, name, message and escaped details.
+ */
+TEST( Json, Error )
+{
+    using tmns::core::error::Error_Code;
+    const auto id = std::to_string( tmns::outcome::wire_category_id<Error_Code>() );
+
+    std::string out;
+    tmns::outcome::write_json( out, tmns::outcome::Error{ Error_Code::NOT_FOUND, "tile \"7\"\n\x01" } );
+    EXPECT_EQ( out, "{\"category\":\"Error\",\"category_id\":" + id + ",\"code\":18,\"name\":\"NOT_FOUND\","
+                    "\"message\":\"NOT_FOUND\",\"details\":\"tile \\\"7\\\"\\n\\u0001\"}" );
+
+    // Categories without tables have no name, and use the category's message
+    out.clear();
+    tmns::outcome::write_json( out, tmns::outcome::Error{ TestErrorCode::FIRST } );
+    EXPECT_EQ( out, "{\"category\":\"TestError\",\"category_id\":" +
+                    std::to_string( tmns::outcome::wire_category_id<TestErrorCode>() ) +
+                    ",\"code\":1,\"message\":\"first\",\"details\":\"\"}" );
+}
+
+/**
+ * @test Errors created by `fail()` include where they were created.
+ */
+TEST( Json, ErrorOrigin )
+{
+    const auto where = std::source_location::current();
+    tmns::outcome::Result<int,TestErrorCode> result = tmns::outcome::fail( TestErrorCode::SECOND );
+
+    std::string out;
+    tmns::outcome::write_json( out, result.error() );
+    if( result.error().origin().line() != 0 )
+    {
+        EXPECT_NE( out.find( ",\"line\":" + std::to_string( where.line() + 1 ) + "}" ), std::string::npos );
+        EXPECT_NE( out.find( "TEST_json.cpp" ), std::string::npos );
+    }
+}
+
+/****************************************************/
+/*           Test the JSON Result Writer            */
+/****************************************************/
+/**
+ * @test Results are appended one object per call.
+ */
+TEST( Json, Result )
+{
+    std::string out;
+    tmns::outcome::write_json( out, tmns::outcome::Result<int,TestErrorCode>{ -4 } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<double,TestErrorCode>{ 0.5 } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<double,TestErrorCode>{ std::numeric_limits<double>::infinity() } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<std::string,TestErrorCode>{ tmns::outcome::ok<std::string>( "a\\b" ) } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<bool,TestErrorCode>{ false } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<void,TestErrorCode>{ tmns::outcome::ok() } );
+    out += '\n';
+    tmns::outcome::write_json( out, tmns::outcome::Result<int,TestErrorCode>{ tmns::outcome::impl::failure( tmns::outcome::Error{ TestErrorCode::SECOND, "x" } ) } );
+
+    EXPECT_EQ( out, "{\"ok\":true,\"value\":-4}\n"
+                    "{\"ok\":true,\"value\":0.5}\n"
+                    "{\"ok\":true,\"value\":null}\n"
+                    "{\"ok\":true,\"value\":\"a\\\\b\"}\n"
+                    "{\"ok\":true,\"value\":false}\n"
+                    "{\"ok\":true}\n"
+                    "{\"ok\":false,\"error\":{\"category\":\"TestError\",\"category_id\":" +
+                    std::to_string( tmns::outcome::wire_category_id<TestErrorCode>() ) +
+                    ",\"code\":2,\"message\":\"second\",\"details\":\"x\"}}" );
+}
@@ -0,0 +1,75 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_module.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+ *
+ * Uses the library through `import terminus.outcome` only.  Built when `with_modules` is enabled.
+ */
+
+// C++ Standard Libraries
+#include <string>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+import terminus.outcome;
+#include <terminus/outcome/macros.hpp>
+
+namespace {
+
+Result<int> parse_digit( char c )
+{
+    if( c < '0' || c > '9' )
+    {
+        return tmns::outcome::fail( tmns::core::error::Error_Code::INVALID_INPUT,
+                                    "not a digit: ", c );
+    }
+    return tmns::outcome::ok<int>( c - '0' );
+}
+
+Result<int> parse_pair( const std::string& text )
+{
+    TERMINUS_OUTCOME_TRY( auto tens, parse_digit( text.at( 0 ) ) );
+    TERMINUS_OUTCOME_TRY( auto ones, parse_digit( text.at( 1 ) ) );
+    return tmns::outcome::ok<int>( tens * 10 + ones );
+}
+
+} // End of anonymous namespace
+
+/****************************************/
+/*          Success and failure         */
+/****************************************/
+TEST( Module, Result_Round_Trip )
+{
+    auto good = parse_pair( "42" );
+    ASSERT_FALSE( good.has_error() );
+    ASSERT_EQ( good.value(), 42 );
+
+    auto bad = parse_pair( "4x" );
+    ASSERT_TRUE( bad.has_error() );
+    ASSERT_EQ( bad.error().code(), tmns::core::error::Error_Code::INVALID_INPUT );
+    ASSERT_NE( bad.error().message().find( "not a digit: x" ), std::string::npos );
+}
+
+/****************************************/
+/*              Optional                */
+/****************************************/
+TEST( Module, Optional )
+{
+    tmns::outcome::Optional<int> empty;
+    ASSERT_FALSE( empty.has_value() );
+
+    tmns::outcome::Optional<int> value{ 7 };
+    ASSERT_TRUE( value.has_value() );
+    ASSERT_EQ( *value, 7 );
+}
@@ -0,0 +1,129 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_multi_error.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <string>
+#include <thread>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/multi_error.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+using Multi_Error = tmns::outcome::Multi_Error<TestErrorCode>;
+
+/****************************************************/
+/*            Test the Multi_Error Class            */
+/****************************************************/
+/**
+ * @test Errors past the limit are counted but not kept.
+ */
+TEST( Multi_Error, Limit )
+{
+    Multi_Error errors{ 2 };
+    EXPECT_FALSE( errors.has_error() );
+    EXPECT_TRUE( errors.as_result().has_value() );
+
+    errors.add( tmns::outcome::Error{ TestErrorCode::FIRST, "scene 1" } );
+    EXPECT_TRUE( errors.add( Result<int>{ 4 } ) );
+    EXPECT_FALSE( errors.add( Result<int>{ tmns::outcome::fail( TestErrorCode::SECOND, "scene 2" ) } ) );
+    for( int i = 0; i < 5; ++i )
+    {
+        errors.add( tmns::outcome::Error{ TestErrorCode::FIRST } );
+    }
+
+    EXPECT_EQ( errors.total(), 7u );
+    EXPECT_EQ( errors.dropped(), 5u );
+    ASSERT_EQ( errors.errors().size(), 2u );
+    EXPECT_EQ( errors.errors()[1].details(), "scene 2" );
+    EXPECT_EQ( errors.count( TestErrorCode::FIRST ), 6u );
+    EXPECT_EQ( errors.count( TestErrorCode::SECOND ), 1u );
+    ASSERT_EQ( errors.counts().size(), 2u );
+    EXPECT_EQ( errors.counts()[0].code, TestErrorCode::FIRST );
+}
+
+/**
+ * @test The summary error has the first code and lists the counts and the kept errors.
+ */
+TEST( Multi_Error, Summary )
+{
+    auto validate = []( const std::vector<int>& scenes ) -> Result<int> {
+        Multi_Error errors{ 1 };
+        for( auto s : scenes )
+        {
+            if( s < 0 )
+            {
+                errors.add( tmns::outcome::Error{ s == -1 ? TestErrorCode::SECOND : TestErrorCode::FIRST,
+                                                  "scene ", s } );
+            }
+        }
+        TERMINUS_OUTCOME_TRY( errors.as_result() );
+        return static_cast<int>( scenes.size() );
+    };
+
+    EXPECT_EQ( validate( { 1, 2 } ).assume_value(), 2 );
+
+    // A single error passes through unchanged
+    EXPECT_EQ( validate( { 1, -2 } ).assume_error().details(), "scene -2" );
+
+    auto r = validate( { -1, 3, -2, -2 } );
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    const auto details = std::string( r.assume_error().details() );
+    EXPECT_NE( details.find( "3 errors" ), std::string::npos ) << details;
+    EXPECT_NE( details.find( "x2" ), std::string::npos ) << details;
+    EXPECT_NE( details.find( "2 not kept" ), std::string::npos ) << details;
+    EXPECT_NE( details.find( "scene -1" ), std::string::npos ) << details;
+}
+
+/**
+ * @test Parallel workers record into shards that merge into one collection.
+ */
+TEST( Multi_Error, Collector )
+{
+    tmns::outcome::Multi_Error_Collector<TestErrorCode> collector{ 4, 3 };
+    std::vector<std::thread> workers;
+    for( int t = 0; t < 4; ++t )
+    {
+        workers.emplace_back( [&collector, t] {
+            for( int i = 0; i < 1000; ++i )
+            {
+                collector.add( Result<void>{ tmns::outcome::fail( t % 2 == 0 ? TestErrorCode::FIRST
+                                                                               : TestErrorCode::SECOND ) } );
+            }
+        } );
+    }
+    for( auto& w : workers )
+    {
+        w.join();
+    }
+
+    auto errors = collector.take();
+    EXPECT_EQ( errors.total(), 4000u );
+    EXPECT_EQ( errors.errors().size(), 4u );
+    EXPECT_EQ( errors.dropped(), 3996u );
+    EXPECT_EQ( errors.count( TestErrorCode::FIRST ), 2000u );
+    EXPECT_EQ( errors.count( TestErrorCode::SECOND ), 2000u );
+    EXPECT_FALSE( collector.take().has_error() );
+}
@@ -0,0 +1,133 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_panic.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <cstdio>
+#include <cstdlib>
+#include <source_location>
+#include <string>
+#include <system_error>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/panic.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS ) && defined( BOOST_NO_EXCEPTIONS )
+TERMINUS_OUTCOME_DEFINE_BOOST_THROW_EXCEPTION()
+#endif
+
+namespace {
+
+/**
+ * @brief Handler that tags the message, so tests can tell it was called instead of the default.
+ */
+[[noreturn]] void tagged_handler( const tmns::outcome::Panic_Info& info )
+{
+    std::fprintf( stderr, "tagged %d %.*s\n",
+                  info.code.value(),
+                  static_cast<int>( info.details.size() ),
+                  info.details.data() );
+    std::_Exit( 3 );
+}
+
+} // End of anonymous namespace
+
+/****************************************************/
+/*            Test the Handler Registry             */
+/****************************************************/
+/**
+ * @test Installing a handler returns the previous one, and null restores the default.
+ */
+TEST( Panic, Set_Handler )
+{
+    const auto original = tmns::outcome::set_panic_handler( &tagged_handler );
+    EXPECT_EQ( original, &tmns::outcome::impl::default_panic_handler );
+    EXPECT_EQ( tmns::outcome::set_panic_handler( nullptr ), &tagged_handler );
+    EXPECT_EQ( tmns::outcome::set_panic_handler( original ), &tmns::outcome::impl::default_panic_handler );
+}
+
+#if defined( TERMINUS_OUTCOME_NO_EXCEPTIONS )
+
+/****************************************************/
+/*             Test the Panic Handler               */
+/****************************************************/
+/**
+ * @test The default handler writes the category, code and details, and aborts.
+ */
+TEST( Panic, Default_Handler )
+{
+    EXPECT_DEATH( tmns::outcome::panic( TestErrorCode::SECOND, "corrupt tile ", 7 ),
+                  "panic: TestError 2: corrupt tile 7" );
+}
+
+/**
+ * @test The handler receives the location of the `panic()` call.
+ */
+TEST( Panic, Handler_Gets_Location )
+{
+    const auto line = std::source_location::current().line() + 1;
+    EXPECT_DEATH( tmns::outcome::panic( TestErrorCode::FIRST ), "TEST_panic.cpp:" + std::to_string( line ) + ": panic" );
+}
+
+/**
+ * @test An installed handler is called in place of throwing.
+ */
+TEST( Panic, Installed_Handler )
+{
+    EXPECT_EXIT( {
+                     tmns::outcome::set_panic_handler( &tagged_handler );
+                     tmns::outcome::panic( TestErrorCode::FIRST, "corrupt" );
+                 },
+                 testing::ExitedWithCode( 3 ),
+                 "tagged 1 corrupt" );
+}
+
+/**
+ * @test Checked access to a missing value or error calls the handler.
+ */
+TEST( Panic, Checked_Access )
+{
+    tmns::outcome::Result<int,TestErrorCode> failed = tmns::outcome::fail( TestErrorCode::FIRST, "tile 7" );
+    EXPECT_DEATH( (void)failed.value(), "tile 7" );
+
+    tmns::outcome::Result<int,TestErrorCode> succeeded{ 4 };
+    EXPECT_DEATH( (void)succeeded.error(), "panic" );
+
+    tmns::outcome::Optional<std::string> name;
+    EXPECT_DEATH( (void)name.value(), "panic" );
+
+    tmns::outcome::Optional<double> ratio;
+    EXPECT_DEATH( (void)ratio.value(), "panic" );
+}
+
+#else
+
+/**
+ * @test With exceptions, `panic()` throws and the handler is not called.
+ */
+TEST( Panic, Throws )
+{
+    const auto original = tmns::outcome::set_panic_handler( &tagged_handler );
+    EXPECT_THROW( tmns::outcome::panic( TestErrorCode::FIRST, "corrupt" ), std::system_error );
+    tmns::outcome::set_panic_handler( original );
+}
+
+#endif
@@ -13,6 +13,13 @@
  * @date    7/5/2023
 */
 
+// C++ Standard Libraries
+#include <array>
+#include <cstddef>
+#include <source_location>
+#include <string>
+#include <string_view>
+
 // GoogleTest Libraries
 #include <gtest/gtest.h>
 
@@ -88,6 +95,44 @@ TEST( Result, ReferenceValue )
     EXPECT_EQ( r.value(), 24 );
 }
 
+/**
+ * @test Results compare equal when both hold equal values or both hold errors with equal codes.
+ */
+TEST( Result, Equality )
+{
+    Result<int> one = 1;
+    Result<int> failed = tmns::outcome::fail( TestErrorCode::FIRST, "details" );
+    EXPECT_TRUE( one == Result<int>{ 1 } );
+    EXPECT_TRUE( one != Result<int>{ 2 } );
+    EXPECT_TRUE( one == Result<long>{ 1L } );
+    EXPECT_FALSE( one == failed );
+    EXPECT_TRUE( failed == Result<int>{ tmns::outcome::fail( TestErrorCode::FIRST ) } );
+    EXPECT_FALSE( failed == Result<int>{ tmns::outcome::fail( TestErrorCode::SECOND ) } );
+
+    Result<void> done = tmns::outcome::ok();
+    EXPECT_TRUE( done == Result<void>{ tmns::outcome::ok() } );
+}
+
+/**
+ * @test Results convert to results with a compatible value type, keeping the value or error.
+ */
+TEST( Result, ConvertingConstructor )
+{
+    Result<long> widened( Result<int>{ 1 } );
+    ASSERT_TRUE( widened.has_value() );
+    EXPECT_EQ( widened.assume_value(), 1L );
+
+    const Result<const char*> name = "tile";
+    Result<std::string> copied( name );
+    EXPECT_EQ( copied.value(), "tile" );
+
+    Result<int> failed = tmns::outcome::fail( TestErrorCode::SECOND, "bad tile" );
+    Result<long> converted( std::move( failed ) );
+    ASSERT_TRUE( converted.has_error() );
+    EXPECT_EQ( converted.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_EQ( converted.assume_error().details(), "bad tile" );
+}
+
 /**
  * @test `TERMINUS_OUTCOME_TRY(expr)` returns early on success without binding a variable.
  */
@@ -154,3 +199,120 @@ TEST( Result, TryMacroVariableFailure )
     EXPECT_TRUE( r.has_error() );
     EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
 }
+
+/**
+ * @test The deferred failure helper produces an error with lazily formatted details.
+ */
+TEST( Result, DeferredFailure )
+{
+    Result<int> r = tmns::outcome::fail( tmns::outcome::cDeferred, TestErrorCode::SECOND, "index ", 12 );
+    EXPECT_TRUE( r.has_failure() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_EQ( r.assume_error().message(), "second: index 12" );
+}
+
+/**
+ * @test Results of small values fit in the 16 bytes a register pair can return.  Opt-in
+ *       diagnostics that make the error larger are exempt.
+ */
+TEST( Result, LayoutIsCompact )
+{
+#if !defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION ) && !defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES ) && !defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+    static_assert( sizeof( Result<int> ) <= 16 );
+    static_assert( sizeof( Result<void> ) <= 16 );
+    EXPECT_LE( sizeof( Result<int> ), 16u );
+#endif
+}
+
+/**
+ * @test Results with a value or a code-only error can be built into constant tables.  Stack
+ *       traces make the error non-literal, so that needs them disabled.
+ */
+TEST( Result, ConstantTable )
+{
+#if !defined( TERMINUS_OUTCOME_ENABLE_STACKTRACE )
+    using Entry = Result<int>;
+    static constinit const std::array<Entry,3> cTable{ Entry{ 10 }, Entry{ TestErrorCode::FIRST }, Entry{ 30 } };
+    static_assert( Entry{ 10 }.value() == 10 );
+    static_assert( Entry{ TestErrorCode::SECOND }.assume_error().code_enum() == TestErrorCode::SECOND );
+    static_assert( Result<void>{ tmns::outcome::ok() }.has_value() );
+
+    EXPECT_EQ( cTable[0].value(), 10 );
+    ASSERT_TRUE( cTable[1].has_error() );
+    EXPECT_EQ( cTable[1].error().code(), TestErrorCode::FIRST );
+    EXPECT_EQ( cTable[2].value(), 30 );
+#endif
+}
+
+/**
+ * @test Errors that had context appended can be returned again with `fail()`.
+ */
+TEST( Result, FailWithContext )
+{
+    auto f = []() -> Result<int> { return tmns::outcome::fail( TestErrorCode::FIRST, "tile ", 2 ); };
+
+    auto g = [&]() -> Result<int> {
+        auto r = f();
+        if( r.has_error() )
+        {
+            return tmns::outcome::fail( std::move( r.assume_error().append( "loading image" ) ) );
+        }
+        return r;
+    };
+
+    auto r = g();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().message(), "first: tile 2: loading image" );
+    EXPECT_EQ( r.assume_error().context().size(), 2 );
+}
+
+/**
+ * @test `fail()` records where the error was created, and errors passed along keep it.
+ */
+TEST( Result, FailRecordsOrigin )
+{
+    [[maybe_unused]] const auto line = std::source_location::current().line() + 1;
+    Result<int> r = tmns::outcome::fail( TestErrorCode::FIRST, "index ", 4 );
+    ASSERT_TRUE( r.has_error() );
+
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION )
+    EXPECT_EQ( r.assume_error().origin().line(), line );
+    EXPECT_NE( std::string_view{ r.assume_error().origin().file_name() }.find( "TEST_result.cpp" ), std::string_view::npos );
+#else
+    EXPECT_EQ( r.assume_error().origin().line(), 0u );
+#endif
+
+    Result<void> passed = tmns::outcome::fail( r.assume_error() );
+    EXPECT_EQ( passed.assume_error().origin().line(), r.assume_error().origin().line() );
+
+#if defined( TERMINUS_OUTCOME_ENABLE_SOURCE_LOCATION )
+    const auto deferred_line = std::source_location::current().line() + 1;
+    Result<void> deferred = tmns::outcome::fail( tmns::outcome::cDeferred, TestErrorCode::SECOND, 1 );
+    EXPECT_EQ( deferred.assume_error().origin().line(), deferred_line );
+#endif
+}
+
+/**
+ * @test `TERMINUS_OUTCOME_TRY` records the sites an error propagates through when enabled.
+ */
+TEST( Result, TryRecordsPropagationSites )
+{
+    auto f = []() -> Result<int> { return tmns::outcome::fail( TestErrorCode::SECOND ); };
+    auto g = [&]() -> Result<int> {
+        TERMINUS_OUTCOME_TRY( auto v, f() );
+        return v;
+    };
+    auto h = [&]() -> Result<int> {
+        TERMINUS_OUTCOME_TRY( g() );
+        return 0;
+    };
+
+    auto r = h();
+    ASSERT_TRUE( r.has_error() );
+#if defined( TERMINUS_OUTCOME_ENABLE_PROPAGATION_SITES )
+    ASSERT_EQ( r.assume_error().propagation_sites().size(), 2u );
+    EXPECT_LT( r.assume_error().propagation_sites()[0].line(), r.assume_error().propagation_sites()[1].line() );
+#else
+    EXPECT_TRUE( r.assume_error().propagation_sites().empty() );
+#endif
+}
@@ -0,0 +1,134 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_result_batch.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <string>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/result_batch.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+using Batch = tmns::outcome::Result_Batch<float,TestErrorCode>;
+
+/****************************************************/
+/*           Test the Result_Batch Class            */
+/****************************************************/
+/**
+ * @test Elements start successful, and values and errors can be set in any order.
+ */
+TEST( Result_Batch, SetValuesAndErrors )
+{
+    Batch batch{ 200 };
+    EXPECT_EQ( batch.size(), 200u );
+    EXPECT_EQ( batch.count_errors(), 0u );
+    EXPECT_FALSE( batch.first_error().has_value() );
+
+    batch.set_error( 150, tmns::outcome::Error{ TestErrorCode::SECOND, "late" } );
+    batch.set_error( 3, tmns::outcome::Error{ TestErrorCode::FIRST, "early" } );
+    batch.set_error( 64, tmns::outcome::Error{ TestErrorCode::FIRST } );
+    batch.set_value( 5, 2.5f );
+    EXPECT_EQ( batch.count_errors(), 3u );
+    EXPECT_EQ( *batch.first_error(), 3u );
+    EXPECT_EQ( batch.error( 150 ).details(), "late" );
+    EXPECT_EQ( batch.value( 5 ), 2.5f );
+
+    ASSERT_EQ( batch.errors().size(), 3u );
+    EXPECT_EQ( batch.errors()[0].index, 3u );
+    EXPECT_EQ( batch.errors()[1].index, 64u );
+    EXPECT_EQ( batch.errors()[2].index, 150u );
+
+    // Replacing an error, then clearing one
+    batch.set_error( 64, tmns::outcome::Error{ TestErrorCode::SECOND } );
+    EXPECT_EQ( batch.error( 64 ).code(), TestErrorCode::SECOND );
+    batch.set_value( 3, 1.0f );
+    EXPECT_EQ( batch.count_errors(), 2u );
+    EXPECT_EQ( *batch.first_error(), 64u );
+
+    auto r = batch.result( 150 );
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_EQ( batch.result( 3 ).assume_value(), 1.0f );
+}
+
+/**
+ * @test `push_back()` and `resize()` keep the bitmap and the side table consistent.
+ */
+TEST( Result_Batch, PushBackAndResize )
+{
+    tmns::outcome::Result_Batch<std::string,TestErrorCode> batch;
+    for( int i = 0; i < 100; ++i )
+    {
+        if( i % 7 == 0 )
+        {
+            batch.push_back( tmns::outcome::fail( TestErrorCode::FIRST ) );
+        }
+        else
+        {
+            batch.push_back( tmns::outcome::ok<std::string>( std::to_string( i ) ) );
+        }
+    }
+    EXPECT_EQ( batch.count_errors(), 15u );
+    EXPECT_EQ( batch.value( 99 ), "99" );
+
+    batch.resize( 50 );
+    EXPECT_EQ( batch.count_errors(), 8u );
+    EXPECT_EQ( batch.errors().back().index, 49u );
+    EXPECT_EQ( batch.success_mask().size(), 1u );
+
+    batch.resize( 130 );
+    EXPECT_EQ( batch.count_errors(), 8u );
+    EXPECT_TRUE( batch.has_value( 129 ) );
+    EXPECT_TRUE( batch.value( 129 ).empty() );
+    EXPECT_EQ( batch.success_mask()[2], 0x3u );
+}
+
+/**
+ * @test `compact_values()` keeps the successful values in order, across whole and partial words.
+ */
+TEST( Result_Batch, CompactValues )
+{
+    Batch batch{ 1000 };
+    auto values = batch.values();
+    for( std::size_t i = 0; i < values.size(); ++i )
+    {
+        values[i] = static_cast<float>( i );
+    }
+    for( std::size_t i = 130; i < 1000; i += 3 )
+    {
+        batch.set_error( i, tmns::outcome::Error{ TestErrorCode::FIRST } );
+    }
+    EXPECT_EQ( batch.values()[130], 0.0f );
+
+    auto compact = batch.compact_values();
+    ASSERT_EQ( compact.size(), 1000u - batch.count_errors() );
+    std::vector<float> expected;
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        if( batch.has_value( i ) )
+        {
+            expected.push_back( static_cast<float>( i ) );
+        }
+    }
+    EXPECT_EQ( compact, expected );
+
+    EXPECT_TRUE( Batch{}.compact_values().empty() );
+}
@@ -0,0 +1,320 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_result_future.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/result_future.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Promise = tmns::outcome::Result_Promise<ValueT,TestErrorCode>;
+
+/****************************************************/
+/*          Test the Result_Promise Class           */
+/****************************************************/
+/**
+ * @test A value stored before `get()` is returned without blocking.
+ */
+TEST( Result_Future, SetValueThenGet )
+{
+    Promise<std::string> promise;
+    auto future = promise.get_future();
+    ASSERT_TRUE( future.valid() );
+    EXPECT_FALSE( future.is_ready() );
+
+    promise.set_value( std::string{ "hello" } );
+    EXPECT_TRUE( future.is_ready() );
+
+    auto r = future.get();
+    ASSERT_TRUE( r.has_value() );
+    EXPECT_EQ( r.assume_value(), "hello" );
+    EXPECT_FALSE( future.valid() );
+}
+
+/**
+ * @test Errors are delivered as results.
+ */
+TEST( Result_Future, SetError )
+{
+    Promise<int> promise;
+    auto future = promise.get_future();
+    promise.set_error( tmns::outcome::Error{ TestErrorCode::FIRST, "details" } );
+
+    auto r = future.get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+    EXPECT_EQ( r.assume_error().details(), "details" );
+}
+
+/**
+ * @test `try_get()` returns nothing until the result is stored.
+ */
+TEST( Result_Future, TryGet )
+{
+    Promise<void> promise;
+    auto future = promise.get_future();
+    EXPECT_FALSE( future.try_get() );
+
+    promise.set_value();
+    auto r = future.try_get();
+    ASSERT_TRUE( r );
+    EXPECT_TRUE( r->has_value() );
+    EXPECT_FALSE( future.valid() );
+}
+
+/**
+ * @test Destroying a promise without a result stores the broken promise code.
+ */
+TEST( Result_Future, BrokenPromise )
+{
+    tmns::outcome::Result_Future<int,TestErrorCode> future;
+    {
+        Promise<int> promise;
+        future = promise.get_future();
+    }
+    auto r = future.get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SUCCESS );
+
+    tmns::outcome::Result_Future<int,tmns::core::error::Error_Code> core;
+    {
+        tmns::outcome::Result_Promise<int,tmns::core::error::Error_Code> promise;
+        core = promise.get_future();
+    }
+    EXPECT_EQ( core.get().assume_error().code(), tmns::core::error::Error_Code::ABORTED );
+}
+
+/**
+ * @test A consumer blocked in `get()` is woken by a producer on another thread.
+ */
+TEST( Result_Future, CrossThread )
+{
+    std::pmr::synchronized_pool_resource pool;
+    std::vector<tmns::outcome::Result_Future<int,TestErrorCode>> futures;
+    std::vector<std::thread> threads;
+    for( int i = 0; i < 8; ++i )
+    {
+        Promise<int> promise{ &pool };
+        futures.push_back( promise.get_future() );
+        threads.emplace_back( [i, p = std::move( promise )]() mutable {
+            std::this_thread::yield();
+            p.set_value( i );
+        } );
+    }
+    for( int i = 0; i < 8; ++i )
+    {
+        auto r = futures[i].get();
+        ASSERT_TRUE( r.has_value() );
+        EXPECT_EQ( r.assume_value(), i );
+    }
+    for( auto& t : threads )
+    {
+        t.join();
+    }
+}
+
+/**
+ * @test A slot keeps the shared state inline.
+ */
+TEST( Result_Future, Slot )
+{
+    tmns::outcome::Result_Slot<std::string,TestErrorCode> slot;
+    auto promise = slot.get_promise();
+    auto future  = promise.get_future();
+    promise.set_result( tmns::outcome::ok<std::string>( "inline" ) );
+    EXPECT_EQ( future.get().assume_value(), "inline" );
+}
+
+/**
+ * @test Reference results are delivered by reference.
+ */
+TEST( Result_Future, Reference )
+{
+    int value = 3;
+    Promise<int&> promise;
+    auto future = promise.get_future();
+    promise.set_value( value );
+
+    auto r = future.get();
+    ASSERT_TRUE( r.has_value() );
+    EXPECT_EQ( &r.assume_value(), &value );
+}
+
+/****************************************************/
+/*              Test the Continuations              */
+/****************************************************/
+namespace {
+
+/**
+ * Executor that queues tasks until `drain()` is called.
+ */
+class Queue_Executor
+{
+    public:
+
+        void execute( std::move_only_function<void()> task )
+        {
+            m_tasks.push_back( std::move( task ) );
+        }
+
+        std::size_t drain()
+        {
+            std::size_t count = 0;
+            while( !m_tasks.empty() )
+            {
+                auto task = std::move( m_tasks.front() );
+                m_tasks.erase( m_tasks.begin() );
+                task();
+                ++count;
+            }
+            return count;
+        }
+
+    private:
+
+        std::vector<std::move_only_function<void()>> m_tasks;
+};
+
+} // End of anonymous namespace
+
+/**
+ * @test `then()` runs on the completing thread and chains values and results.
+ */
+TEST( Result_Future, Then )
+{
+    Promise<int> promise;
+    auto future = promise.get_future()
+                      .then( []( int v ) { return v * 2; } )
+                      .then( []( int v ) -> tmns::outcome::Result<std::string,TestErrorCode> { return tmns::outcome::ok<std::string>( std::to_string( v ) ); } )
+                      .then( []( const std::string& s ) { EXPECT_EQ( s, "42" ); } );
+    EXPECT_FALSE( future.is_ready() );
+
+    promise.set_value( 21 );
+    ASSERT_TRUE( future.is_ready() );
+    EXPECT_TRUE( future.get().has_value() );
+}
+
+/**
+ * @test Continuations attached to a ready future run immediately.
+ */
+TEST( Result_Future, ThenWhenReady )
+{
+    Promise<void> promise;
+    auto future = promise.get_future();
+    promise.set_value();
+
+    bool ran = false;
+    auto next = std::move( future ).then( [&] { ran = true; return 5; } );
+    EXPECT_TRUE( ran );
+    EXPECT_EQ( next.get().assume_value(), 5 );
+}
+
+/**
+ * @test Errors skip success continuations and reach `on_error()` and `finally()`.
+ */
+TEST( Result_Future, ErrorShortCircuits )
+{
+    Promise<int> promise;
+    int  then_calls = 0;
+    bool saw_error  = false;
+    bool finished   = false;
+    auto future = promise.get_future()
+                      .then( [&]( int v ) { ++then_calls; return v; } )
+                      .then( [&]( int v ) { ++then_calls; return v; } )
+                      .on_error( [&]( const tmns::outcome::Error<TestErrorCode>& e ) {
+                          saw_error = ( e.code() == TestErrorCode::SECOND );
+                      } )
+                      .finally( [&] { finished = true; } );
+
+    promise.set_error( tmns::outcome::Error{ TestErrorCode::SECOND } );
+    EXPECT_EQ( then_calls, 0 );
+    EXPECT_TRUE( saw_error );
+    EXPECT_TRUE( finished );
+
+    auto r = future.get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+}
+
+/**
+ * @test `on_error()` can recover with a value.
+ */
+TEST( Result_Future, OnErrorRecovers )
+{
+    Promise<int> promise;
+    auto future = promise.get_future()
+                      .on_error( []( const tmns::outcome::Error<TestErrorCode>& ) { return -1; } )
+                      .then( []( int v ) { return v * 10; } );
+    promise.set_error( tmns::outcome::Error{ TestErrorCode::FIRST } );
+    EXPECT_EQ( future.get().assume_value(), -10 );
+}
+
+/**
+ * @test Continuations given an executor are posted to it instead of running inline.
+ */
+TEST( Result_Future, Executor )
+{
+    Queue_Executor executor;
+    Promise<int> promise;
+    auto future = promise.get_future()
+                      .then( executor, []( int v ) { return v + 1; } )
+                      .finally( executor, [] {} );
+
+    promise.set_value( 1 );
+    EXPECT_FALSE( future.is_ready() );
+    EXPECT_EQ( executor.drain(), 2u );
+    EXPECT_EQ( future.get().assume_value(), 2 );
+}
+
+/**
+ * @test Continuations run on the producing thread.
+ */
+TEST( Result_Future, ThenCrossThread )
+{
+    std::atomic<int> done{ 0 };
+    std::vector<std::thread> threads;
+    std::vector<tmns::outcome::Result_Future<int,TestErrorCode>> futures;
+    for( int i = 0; i < 16; ++i )
+    {
+        Promise<int> promise;
+        futures.push_back( promise.get_future().then( [&done]( int v ) { ++done; return v; } ) );
+        threads.emplace_back( [i, p = std::move( promise )]() mutable { p.set_value( i ); } );
+    }
+    for( int i = 0; i < 16; ++i )
+    {
+        EXPECT_EQ( futures[i].get().assume_value(), i );
+    }
+    for( auto& t : threads )
+    {
+        t.join();
+    }
+    EXPECT_EQ( done.load(), 16 );
+}
@@ -0,0 +1,209 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_thread_pool.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <atomic>
+#include <chrono>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/future_combinators.hpp>
+#include <terminus/outcome/result_future.hpp>
+#include <terminus/outcome/thread_pool.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+template <class ValueT>
+using Result = tmns::outcome::Result<ValueT,TestErrorCode>;
+
+template <class ValueT>
+using Future = tmns::outcome::Result_Future<ValueT,TestErrorCode>;
+
+/****************************************************/
+/*             Test the Thread_Pool Class           */
+/****************************************************/
+/**
+ * @test Submitted jobs deliver their results through futures.
+ */
+TEST( Thread_Pool, Submit )
+{
+    tmns::outcome::Thread_Pool pool{ 4 };
+    EXPECT_EQ( pool.size(), 4u );
+
+    std::vector<Future<int>> futures;
+    for( int i = 0; i < 100; ++i )
+    {
+        futures.push_back( pool.submit( [i]() -> Result<int> {
+            if( i == 7 )
+            {
+                return tmns::outcome::fail( TestErrorCode::FIRST );
+            }
+            return i * 2;
+        } ) );
+    }
+    for( int i = 0; i < 100; ++i )
+    {
+        auto r = futures[i].get();
+        if( i == 7 )
+        {
+            ASSERT_TRUE( r.has_error() );
+            EXPECT_EQ( r.assume_error().code(), TestErrorCode::FIRST );
+        }
+        else
+        {
+            EXPECT_EQ( r.assume_value(), i * 2 );
+        }
+    }
+}
+
+/**
+ * @test Jobs posted from workers run, and continuations can be posted to the pool.
+ */
+TEST( Thread_Pool, NestedAndContinuations )
+{
+    std::atomic<int> count{ 0 };
+    {
+        tmns::outcome::Thread_Pool pool{ 2 };
+        for( int i = 0; i < 50; ++i )
+        {
+            pool.execute( [&] {
+                ++count;
+                pool.execute( [&] { ++count; } );
+            } );
+        }
+        auto r = pool.submit( [] { return Result<int>{ 20 }; } )
+                     .then( pool, []( int v ) { return v + 1; } )
+                     .get();
+        EXPECT_EQ( r.assume_value(), 21 );
+    }
+    EXPECT_EQ( count.load(), 100 );
+}
+
+/**
+ * @test A stopped job is skipped and completes with the broken promise code.
+ */
+TEST( Thread_Pool, Stop )
+{
+    tmns::outcome::Thread_Pool pool{ 1 };
+    std::stop_source stop;
+    stop.request_stop();
+    bool ran = false;
+    auto r = pool.submit( stop.get_token(), [&] { ran = true; return Result<int>{ 1 }; } ).get();
+    EXPECT_FALSE( ran );
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SUCCESS );
+}
+
+/****************************************************/
+/*              Test the Combinators                */
+/****************************************************/
+/**
+ * @test `when_all()` collects values in order.
+ */
+TEST( Future_Combinators, WhenAll )
+{
+    tmns::outcome::Thread_Pool pool{ 4 };
+    std::vector<Future<int>> futures;
+    for( int i = 0; i < 32; ++i )
+    {
+        futures.push_back( pool.submit( [i] { return Result<int>{ i }; } ) );
+    }
+    auto r = tmns::outcome::when_all( std::move( futures ) ).get();
+    ASSERT_TRUE( r.has_value() );
+    ASSERT_EQ( r.assume_value().size(), 32u );
+    for( int i = 0; i < 32; ++i )
+    {
+        EXPECT_EQ( r.assume_value()[i], i );
+    }
+
+    EXPECT_TRUE( tmns::outcome::when_all( std::vector<Future<int>>{} ).get().assume_value().empty() );
+    EXPECT_TRUE( tmns::outcome::when_all( std::vector<Future<void>>{} ).get().has_value() );
+}
+
+/**
+ * @test The first error completes `when_all()` and stops work that has not started.
+ */
+TEST( Future_Combinators, WhenAllCancels )
+{
+    tmns::outcome::Thread_Pool pool{ 1 };
+    std::stop_source stop;
+    std::atomic<int> ran{ 0 };
+
+    // Hold the only worker until every job is queued
+    std::atomic<bool> release{ false };
+    pool.execute( [&] { release.wait( false ); } );
+
+    std::vector<Future<void>> futures;
+    futures.push_back( pool.submit( stop.get_token(), [&] {
+        ++ran;
+        return Result<void>{ tmns::outcome::fail( TestErrorCode::SECOND ) };
+    } ) );
+    for( int i = 0; i < 10; ++i )
+    {
+        futures.push_back( pool.submit( stop.get_token(), [&] { ++ran; return Result<void>{ tmns::outcome::ok() }; } ) );
+    }
+    auto all = tmns::outcome::when_all( std::move( futures ), stop );
+    release = true;
+    release.notify_one();
+
+    auto r = all.get();
+    ASSERT_TRUE( r.has_error() );
+    EXPECT_EQ( r.assume_error().code(), TestErrorCode::SECOND );
+    EXPECT_TRUE( stop.stop_requested() );
+    EXPECT_LT( ran.load(), 11 );
+}
+
+/**
+ * @test `when_any()` produces the first success, or the last error if all fail.
+ */
+TEST( Future_Combinators, WhenAny )
+{
+    tmns::outcome::Result_Promise<int,TestErrorCode> slow;
+    tmns::outcome::Result_Promise<int,TestErrorCode> failing;
+    tmns::outcome::Result_Promise<int,TestErrorCode> fast;
+    std::vector<Future<int>> futures;
+    futures.push_back( slow.get_future() );
+    futures.push_back( failing.get_future() );
+    futures.push_back( fast.get_future() );
+
+    std::stop_source stop;
+    auto any = tmns::outcome::when_any( std::move( futures ), stop );
+    failing.set_error( tmns::outcome::Error{ TestErrorCode::FIRST } );
+    EXPECT_FALSE( any.is_ready() );
+    fast.set_value( 3 );
+    EXPECT_TRUE( stop.stop_requested() );
+    slow.set_value( 1 );
+    EXPECT_EQ( any.get().assume_value(), 3 );
+
+    tmns::outcome::Result_Promise<int,TestErrorCode> a;
+    tmns::outcome::Result_Promise<int,TestErrorCode> b;
+    std::vector<Future<int>> failures;
+    failures.push_back( a.get_future() );
+    failures.push_back( b.get_future() );
+    auto none = tmns::outcome::when_any( std::move( failures ) );
+    a.set_error( tmns::outcome::Error{ TestErrorCode::FIRST } );
+    b.set_error( tmns::outcome::Error{ TestErrorCode::SECOND } );
+    EXPECT_EQ( none.get().assume_error().code(), TestErrorCode::SECOND );
+
+    EXPECT_TRUE( tmns::outcome::when_any( std::vector<Future<int>>{} ).get().has_error() );
+}
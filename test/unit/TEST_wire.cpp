@@ -0,0 +1,205 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_wire.cpp
+ * @author  Marvin Smith
+ * @date    10/16/2026
+*/
+
+// C++ Standard Libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// GoogleTest Libraries
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/outcome.hpp>
+#include <terminus/outcome/wire.hpp>
+
+// Local Test Utilities
+#include "TEST_error_code.hpp"
+
+enum class Wire_Test_Code { SUCCESS = 0, LOST = 1 };
+
+TERMINUS_OUTCOME_MARK_ENUM( Wire_Test_Code )
+
+/**
+ * @brief Category that picks its own wire id.
+ */
+class Wire_Test_Category : public tmns::outcome::Error_Category<Wire_Test_Category>
+{
+    public:
+
+        static constexpr std::uint32_t cWireId = 7;
+
+        static constexpr std::array<std::string_view,2> cMessages { "success", "lost" };
+
+    protected:
+
+        const char* name_() const noexcept override
+        {
+            return "WireTest";
+        }
+
+}; // End of Wire_Test_Category Class
+
+TERMINUS_OUTCOME_ASSOCIATE_ERROR_CATEGORY( Wire_Test_Category, Wire_Test_Code );
+
+/****************************************************/
+/*            Test the Category Registry            */
+/****************************************************/
+/**
+ * @test Ids come from the category name, or from `cWireId`, and map back to the category once
+ *       registered.
+ */
+TEST( Wire, CategoryIds )
+{
+    using tmns::core::error::Error_Code;
+    EXPECT_EQ( tmns::outcome::wire_category_id<Error_Code>(),
+               static_cast<std::uint32_t>( tmns::outcome::impl::hash_name( "Error", 0 ) ) );
+    EXPECT_EQ( tmns::outcome::wire_category_id<Wire_Test_Code>(), 7 );
+
+    EXPECT_EQ( tmns::outcome::wire_category( 0xFFFFFFFE ), nullptr );
+    EXPECT_TRUE( tmns::outcome::register_wire_category<Wire_Test_Code>() );
+    EXPECT_EQ( tmns::outcome::wire_category( 7 ), &Wire_Test_Category::get() );
+}
+
+/****************************************************/
+/*          Test the Error Wire Format              */
+/****************************************************/
+/**
+ * @test An error round-trips, with its details read in place.
+ */
+TEST( Wire, ErrorRoundTrip )
+{
+    using tmns::core::error::Error_Code;
+    std::vector<std::byte> buffer;
+    tmns::outcome::encode( buffer, tmns::outcome::Error{ Error_Code::FILE_NOT_FOUND, "tile ", 7 } );
+
+    tmns::outcome::Wire_Reader reader{ buffer };
+    const auto view = reader.read_error();
+    ASSERT_TRUE( view );
+    EXPECT_TRUE( reader.empty() );
+    EXPECT_TRUE( view->is<Error_Code>() );
+    EXPECT_FALSE( view->is<TestErrorCode>() );
+    EXPECT_EQ( view->code, static_cast<int>( Error_Code::FILE_NOT_FOUND ) );
+    EXPECT_EQ( view->details, "tile 7" );
+    EXPECT_EQ( static_cast<const void*>( view->details.data() ), static_cast<const void*>( buffer.data() + buffer.size() - 6 ) );
+
+    // Encoding registered the category
+    ASSERT_TRUE( view->error_code() );
+    EXPECT_EQ( *view->error_code(), make_error_code( Error_Code::FILE_NOT_FOUND ) );
+
+    const auto error = view->to_error<Error_Code>();
+    ASSERT_TRUE( error );
+    EXPECT_EQ( error->code(), make_error_code( Error_Code::FILE_NOT_FOUND ) );
+    EXPECT_EQ( error->details(), "tile 7" );
+    EXPECT_FALSE( view->to_error<TestErrorCode>() );
+
+    // A small explicit id, a small code and no details take three bytes
+    buffer.clear();
+    tmns::outcome::encode( buffer, tmns::outcome::Error{ Wire_Test_Code::LOST } );
+    EXPECT_EQ( buffer.size(), 3 );
+}
+
+/**
+ * @test Results of each supported value type round-trip back to back in one buffer.
+ */
+TEST( Wire, ResultRoundTrip )
+{
+    using tmns::core::error::Error_Code;
+    std::vector<std::byte> buffer;
+    tmns::outcome::encode( buffer, tmns::outcome::Result<int,Error_Code>{ -300 } );
+    tmns::outcome::encode( buffer, tmns::outcome::Result<std::string,Error_Code>{ tmns::outcome::ok<std::string>( "north" ) } );
+    tmns::outcome::encode( buffer, tmns::outcome::Result<double,Error_Code>{ 0.25 } );
+    tmns::outcome::encode( buffer, tmns::outcome::Result<bool,Error_Code>{ true } );
+    tmns::outcome::encode( buffer, tmns::outcome::Result<void,Error_Code>{ tmns::outcome::ok() } );
+    tmns::outcome::encode( buffer, tmns::outcome::Result<std::uint64_t,Error_Code>{ tmns::outcome::fail( Error_Code::OUT_OF_MEMORY ) } );
+
+    tmns::outcome::Wire_Reader reader{ buffer };
+    const auto i = reader.read_result<int>();
+    ASSERT_TRUE( i && i->has_value() );
+    EXPECT_EQ( i->value(), -300 );
+
+    const auto s = reader.read_result<std::string>();
+    ASSERT_TRUE( s && s->has_value() );
+    EXPECT_EQ( s->value(), "north" );
+    const auto owned = s->to_result<Error_Code>();
+    ASSERT_TRUE( owned );
+    EXPECT_EQ( owned->value(), "north" );
+
+    const auto d = reader.read_result<double>();
+    ASSERT_TRUE( d && d->has_value() );
+    EXPECT_EQ( d->value(), 0.25 );
+
+    const auto b = reader.read_result<bool>();
+    ASSERT_TRUE( b && b->has_value() );
+    EXPECT_TRUE( b->value() );
+
+    const auto v = reader.read_result<void>();
+    ASSERT_TRUE( v && v->has_value() );
+    EXPECT_TRUE( v->to_result<Error_Code>() );
+
+    const auto e = reader.read_result<std::uint64_t>();
+    ASSERT_TRUE( e && e->has_error() );
+    EXPECT_EQ( e->error().code, static_cast<int>( Error_Code::OUT_OF_MEMORY ) );
+    const auto failed = e->to_result<Error_Code>();
+    ASSERT_TRUE( failed && failed->has_error() );
+    EXPECT_EQ( failed->error().code(), make_error_code( Error_Code::OUT_OF_MEMORY ) );
+
+    EXPECT_TRUE( reader.empty() );
+}
+
+/**
+ * @test Truncated and malformed input is rejected without moving the reader.
+ */
+TEST( Wire, MalformedInput )
+{
+    using tmns::core::error::Error_Code;
+    std::vector<std::byte> buffer;
+    tmns::outcome::encode( buffer, tmns::outcome::Result<int,Error_Code>{ tmns::outcome::fail( Error_Code::NOT_FOUND, "missing" ) } );
+
+    for( std::size_t size = 0; size < buffer.size(); ++size )
+    {
+        tmns::outcome::Wire_Reader reader{ std::span( buffer ).first( size ) };
+        EXPECT_FALSE( reader.read_result<int>() );
+        EXPECT_EQ( reader.remaining(), size );
+    }
+
+    // Unknown tag, overlong varint, and a value out of range of the requested type
+    const std::vector<std::byte> tag{ std::byte{ 2 } };
+    EXPECT_FALSE( tmns::outcome::Wire_Reader{ tag }.read_result<int>() );
+    const std::vector<std::byte> overlong( 11, std::byte{ 0x80 } );
+    EXPECT_FALSE( tmns::outcome::Wire_Reader{ overlong }.read_varint() );
+
+    // The tenth byte of a varint may only hold bit 63, and must end it
+    std::vector<std::byte> max( 9, std::byte{ 0xFF } );
+    max.push_back( std::byte{ 0x01 } );
+    EXPECT_EQ( tmns::outcome::Wire_Reader{ max }.read_varint(), std::numeric_limits<std::uint64_t>::max() );
+    for( const auto last : { std::byte{ 0x02 }, std::byte{ 0x7F }, std::byte{ 0x81 } } )
+    {
+        auto overflow = max;
+        overflow.back() = last;
+        overflow.push_back( std::byte{ 0x00 } );
+        tmns::outcome::Wire_Reader reader{ overflow };
+        EXPECT_FALSE( reader.read_varint() );
+        EXPECT_EQ( reader.remaining(), overflow.size() );
+    }
+    std::vector<std::byte> big;
+    tmns::outcome::encode( big, tmns::outcome::Result<int,Error_Code>{ 1000 } );
+    EXPECT_FALSE( tmns::outcome::Wire_Reader{ big }.read_result<std::int8_t>() );
+}